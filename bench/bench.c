@@ -0,0 +1,459 @@
+/**
+    @file
+
+    @brief Micro-benchmark for the hydra core API hot paths.
+
+    Builds a synthetic frontend and a synthetic core into one process and measures the cost of the
+    API surface itself: the copying video/audio push paths against their zero-copy counterparts, the
+    pointer-chasing input poll, and the cold-start cost of the function table exchange. The core side
+    calls through the imported function pointers loaded by hcInternalLoadFunctionTable, so every call
+    pays the same indirection a real core pays.
+
+    Run it on each target SoC to quantify API regressions and to compare copy against zero-copy
+    delivery; numbers are per-call latency percentiles plus throughput for the data paths.
+*/
+
+#include <hydra/core.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+/* ------------------------------------------------------------ */
+/* Timing and reporting                                          */
+
+static uint64_t nowNs(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ull + (uint64_t)ts.tv_nsec;
+}
+
+static int compareU64(const void* a, const void* b) {
+    uint64_t x = *(const uint64_t*)a;
+    uint64_t y = *(const uint64_t*)b;
+    return x < y ? -1 : x > y ? 1 : 0;
+}
+
+/// Report per-call latency percentiles and, when bytesPerCall is nonzero, throughput.
+static void report(const char* name, uint64_t* samples, int count, size_t bytesPerCall) {
+    qsort(samples, (size_t)count, sizeof(uint64_t), compareU64);
+    uint64_t total = 0;
+    for (int i = 0; i < count; i++) {
+        total += samples[i];
+    }
+    double mean = (double)total / count;
+    printf("%-38s %8.0f ns/call  p50 %6llu  p90 %6llu  p99 %6llu  max %8llu",
+           name, mean,
+           (unsigned long long)samples[count / 2],
+           (unsigned long long)samples[count * 9 / 10],
+           (unsigned long long)samples[count * 99 / 100],
+           (unsigned long long)samples[count - 1]);
+    if (bytesPerCall != 0 && mean > 0.0) {
+        printf("  %8.1f MB/s", (double)bytesPerCall * 1e9 / mean / (1024.0 * 1024.0));
+    }
+    printf("\n");
+}
+
+/* ------------------------------------------------------------ */
+/* Synthetic frontend                                            */
+
+/// The largest frame the benches push: 1920x1080 RGBA32.
+#define BENCH_MAX_FRAME_BYTES (1920 * 1080 * 4)
+#define BENCH_AUDIO_RING_FRAMES 16384
+#define BENCH_SAMPLES 1000
+
+struct HcInstance_T {
+    int unused;
+};
+
+static struct HcInstance_T benchInstance;
+
+static uint8_t stagingBuffer[BENCH_MAX_FRAME_BYTES]; /* texture upload staging, push path copies into this */
+static uint8_t uploadHeap[BENCH_MAX_FRAME_BYTES];    /* "persistently mapped" heap for the acquire path */
+static uint8_t audioRingStorage[BENCH_AUDIO_RING_FRAMES * 4];
+static HcAudioStreamBuffer audioRing;
+static int64_t inputState[4][32];
+
+static void feGetHostInfo(HcHostInfo* hostInfo) {
+    hostInfo->architecture = HC_ARCHITECTURE_UNKNOWN;
+    hostInfo->operatingSystem = HC_OPERATING_SYSTEM_UNKNOWN;
+}
+
+static HcResult feGetInputsSync(HcInstance instance, const HcInputRequest* const* requests,
+                                int requestCount, const int64_t* const* values) {
+    (void)instance;
+    /* The frontend pays the two indirections per input that the SoA request targets. */
+    for (int i = 0; i < requestCount; i++) {
+        *(int64_t*)values[i] = inputState[requests[i]->port][requests[i]->inputType];
+    }
+    return HC_SUCCESS;
+}
+
+static HcResult feReconfigureEnvironment(HcInstance instance, const HcEnvironmentInfo* environmentInfo) {
+    (void)instance;
+    (void)environmentInfo;
+    return HC_SUCCESS;
+}
+
+static HcResult fePushSamples(HcInstance instance, const HcAudioData* audioData) {
+    (void)instance;
+    /* Per-call want/have validation plus the copy, like a real queueing frontend. */
+    if (audioData->want.format == HC_AUDIO_FORMAT_NULL || audioData->want.channels == HC_AUDIO_CHANNELS_NULL ||
+        audioData->want.sampleRate == 0) {
+        return HC_ERROR_BAD_AUDIO_DATA_WANT;
+    }
+    if (audioData->have.format != HC_AUDIO_FORMAT_S16_PCM || audioData->have.channels != HC_AUDIO_CHANNELS_STEREO) {
+        return HC_ERROR_BAD_AUDIO_DATA_HAVE;
+    }
+    size_t bytes = (size_t)audioData->sampleCount * 4;
+    if (bytes > sizeof(audioRingStorage)) {
+        return HC_ERROR_AUDIO_OVERRUN;
+    }
+    memcpy(audioRingStorage, audioData->data, bytes);
+    return HC_SUCCESS;
+}
+
+static HcResult feAudioOpenStream(HcInstance instance, const HcAudioInfo* info, HcAudioStreamBuffer** stream) {
+    (void)instance;
+    audioRing.type = HC_STRUCTURE_TYPE_AUDIO_STREAM_BUFFER;
+    audioRing.data = audioRingStorage;
+    audioRing.frameCapacity = BENCH_AUDIO_RING_FRAMES;
+    audioRing.frameSize = 4;
+    audioRing.writeIndex = 0;
+    audioRing.readIndex = 0;
+    audioRing.info = *info;
+    *stream = &audioRing;
+    return HC_SUCCESS;
+}
+
+static HcResult feAudioCloseStream(HcInstance instance, HcAudioStreamBuffer* stream) {
+    (void)instance;
+    (void)stream;
+    return HC_SUCCESS;
+}
+
+static HcResult feSwPushVideoFrame(HcInstance instance, const HcImageData* image) {
+    (void)instance;
+    /* The copy the zero-copy path exists to remove. */
+    memcpy(stagingBuffer, image->data, (size_t)image->stride * image->height);
+    return HC_SUCCESS;
+}
+
+static HcResult feSwAcquireFrameBuffer(HcInstance instance, HcImageData* image) {
+    (void)instance;
+    /* The core described the frame; the frontend returns the buffer and its row pitch. */
+    image->data = uploadHeap;
+    image->stride = image->width * image->channels;
+    return HC_SUCCESS;
+}
+
+static HcResult feSwPresentFrameBuffer(HcInstance instance, const HcImageData* image) {
+    (void)instance;
+    (void)image;
+    return HC_SUCCESS;
+}
+
+static HcResult feGlMakeCurrent(HcInstance instance) {
+    (void)instance;
+    return HC_ERROR_NOT_OPENGL_RENDERED;
+}
+
+static HcResult feGlSwapBuffers(HcInstance instance) {
+    (void)instance;
+    return HC_ERROR_NOT_OPENGL_RENDERED;
+}
+
+static void* feGlGetProcAddress(HcInstance instance, const char* name) {
+    (void)instance;
+    (void)name;
+    return NULL;
+}
+
+static HcResult feSetCallbacks(HcInstance instance, const HcCallbacks* callbacks) {
+    (void)instance;
+    (void)callbacks;
+    return HC_SUCCESS;
+}
+
+static HcResult feVkPushVideoFrame(HcInstance instance, const HcVulkanFrameInfo* image) {
+    (void)instance;
+    (void)image;
+    return HC_ERROR_NOT_VULKAN_RENDERED;
+}
+
+static HcResult feWaitForDisplay(HcInstance instance, HcDisplayTimingInfo* timing) {
+    (void)instance;
+    timing->timestampNs = nowNs();
+    timing->refreshPeriodNs = 16666667;
+    return HC_SUCCESS;
+}
+
+static HcResult feGlCreateSharedContext(HcInstance instance, HcGlSharedContext* context) {
+    (void)instance;
+    (void)context;
+    return HC_ERROR_UNSUPPORTED;
+}
+
+static HcResult feGlMakeCurrentShared(HcInstance instance, HcGlSharedContext context) {
+    (void)instance;
+    (void)context;
+    return HC_ERROR_NOT_OPENGL_RENDERED;
+}
+
+static HcResult feGlDestroySharedContext(HcInstance instance, HcGlSharedContext context) {
+    (void)instance;
+    (void)context;
+    return HC_ERROR_NOT_OPENGL_RENDERED;
+}
+
+static HcResult feGetAudioQueueStatus(HcInstance instance, HcAudioQueueStatus* status) {
+    (void)instance;
+    status->fillFrames = audioRing.writeIndex - audioRing.readIndex;
+    status->capacityFrames = BENCH_AUDIO_RING_FRAMES;
+    status->deviceLatencyFrames = 0;
+    status->driftPpm = 0;
+    return HC_SUCCESS;
+}
+
+static HcResult feCreateLock(HcInstance instance, const HcLockRequest* request, HcLock* lock) {
+    (void)instance;
+    (void)request;
+    (void)lock;
+    /* This synthetic frontend doesn't vend locks. */
+    return HC_ERROR_UNSUPPORTED;
+}
+
+static HcResult feLock(HcInstance instance, HcLock lock) {
+    (void)instance;
+    (void)lock;
+    return HC_ERROR_BAD_LOCK;
+}
+
+static HcResult feUnlock(HcInstance instance, HcLock lock) {
+    (void)instance;
+    (void)lock;
+    return HC_ERROR_BAD_LOCK;
+}
+
+static HcResult feDestroyLock(HcInstance instance, HcLock lock) {
+    (void)instance;
+    (void)lock;
+    return HC_ERROR_BAD_LOCK;
+}
+
+static HcResult feMtlPushVideoFrame(HcInstance instance, const HcMetalFrameInfo* image) {
+    (void)instance;
+    (void)image;
+    return HC_ERROR_NOT_METAL_RENDERED;
+}
+
+static HcResult feD3dPushVideoFrame(HcInstance instance, const HcDirect3DFrameInfo* image) {
+    (void)instance;
+    (void)image;
+    return HC_ERROR_NOT_DIRECT3D_RENDERED;
+}
+
+static uint8_t storageRegion[64 * 1024];
+
+static HcResult feStorageMap(HcInstance instance, const char* name, size_t size, void** data) {
+    (void)instance;
+    (void)name;
+    if (size > sizeof(storageRegion)) {
+        return HC_ERROR_BAD_STORAGE;
+    }
+    *data = storageRegion;
+    return HC_SUCCESS;
+}
+
+static HcResult feStorageUnmap(HcInstance instance, const char* name) {
+    (void)instance;
+    (void)name;
+    return HC_SUCCESS;
+}
+
+static HcResult feStorageFlush(HcInstance instance, const char* name) {
+    (void)instance;
+    (void)name;
+    return HC_SUCCESS;
+}
+
+static HcResult feGetInputsBatched(HcInstance instance, const uint32_t* ports, const HcInputType* inputTypes,
+                                   int64_t* values, uint32_t inputCount) {
+    (void)instance;
+    /* One linear sweep, no pointer chasing. */
+    for (uint32_t i = 0; i < inputCount; i++) {
+        values[i] = inputState[ports[i]][inputTypes[i]];
+    }
+    return HC_SUCCESS;
+}
+
+static const HcFrontendFunctionTable benchTable = {
+    sizeof(HcFrontendFunctionTable), HYDRA_CORE_VERSION,
+    feGetHostInfo, feGetInputsSync, feReconfigureEnvironment, fePushSamples,
+    feAudioOpenStream, feAudioCloseStream, feSwPushVideoFrame,
+    feSwAcquireFrameBuffer, feSwPresentFrameBuffer, feGlMakeCurrent,
+    feGlSwapBuffers, feGlGetProcAddress, feSetCallbacks, feVkPushVideoFrame,
+    feWaitForDisplay, feGlCreateSharedContext, feGlMakeCurrentShared,
+    feGlDestroySharedContext, feGetAudioQueueStatus, feCreateLock, feLock,
+    feUnlock, feDestroyLock, feMtlPushVideoFrame, feD3dPushVideoFrame,
+    feGetInputsBatched, feStorageMap, feStorageUnmap, feStorageFlush,
+};
+
+/* ------------------------------------------------------------ */
+/* Benches (the synthetic core side)                             */
+
+static uint64_t latencySamples[BENCH_SAMPLES];
+
+static void benchLoadFunctionTable(void) {
+    for (int i = 0; i < BENCH_SAMPLES; i++) {
+        uint64_t start = nowNs();
+        if (hcInternalLoadFunctionTable(&benchTable) != HC_SUCCESS) {
+            fprintf(stderr, "function table exchange failed\n");
+            exit(1);
+        }
+        latencySamples[i] = nowNs() - start;
+    }
+    report("hcInternalLoadFunctionTable", latencySamples, BENCH_SAMPLES, 0);
+}
+
+static uint8_t frameSource[BENCH_MAX_FRAME_BYTES];
+
+static void benchSwPushVideoFrame(uint32_t width, uint32_t height, HcPixelFormat format, uint32_t bytesPerPixel) {
+    HcImageData image = {HC_STRUCTURE_TYPE_IMAGE_DATA, NULL, frameSource, width, height,
+                         bytesPerPixel, width * bytesPerPixel, format};
+    for (int i = 0; i < BENCH_SAMPLES; i++) {
+        uint64_t start = nowNs();
+        hcSwPushVideoFrame(&benchInstance, &image);
+        latencySamples[i] = nowNs() - start;
+    }
+    char name[64];
+    snprintf(name, sizeof(name), "hcSwPushVideoFrame %ux%u/%ubpp", width, height, bytesPerPixel * 8);
+    report(name, latencySamples, BENCH_SAMPLES, (size_t)width * height * bytesPerPixel);
+}
+
+static void benchSwAcquirePresent(uint32_t width, uint32_t height, uint32_t bytesPerPixel) {
+    for (int i = 0; i < BENCH_SAMPLES; i++) {
+        HcImageData image = {HC_STRUCTURE_TYPE_IMAGE_DATA, NULL, NULL, width, height,
+                             bytesPerPixel, 0, HC_PIXEL_FORMAT_RGBA32};
+        uint64_t start = nowNs();
+        hcSwAcquireFrameBuffer(&benchInstance, &image);
+        hcSwPresentFrameBuffer(&benchInstance, &image);
+        latencySamples[i] = nowNs() - start;
+    }
+    char name[64];
+    snprintf(name, sizeof(name), "hcSwAcquire+Present %ux%u/%ubpp", width, height, bytesPerPixel * 8);
+    report(name, latencySamples, BENCH_SAMPLES, (size_t)width * height * bytesPerPixel);
+}
+
+static void benchPushSamples(uint32_t sampleCount) {
+    static uint8_t chunk[4800 * 4];
+    HcAudioInfo info = {HC_STRUCTURE_TYPE_AUDIO_INFO, NULL, HC_AUDIO_FORMAT_S16_PCM,
+                        HC_AUDIO_CHANNELS_STEREO, 48000};
+    HcAudioData audioData = {HC_STRUCTURE_TYPE_AUDIO_DATA, NULL, chunk, sampleCount, info, info};
+    for (int i = 0; i < BENCH_SAMPLES; i++) {
+        uint64_t start = nowNs();
+        hcPushSamples(&benchInstance, &audioData);
+        latencySamples[i] = nowNs() - start;
+    }
+    char name[64];
+    snprintf(name, sizeof(name), "hcPushSamples %u frames", sampleCount);
+    report(name, latencySamples, BENCH_SAMPLES, (size_t)sampleCount * 4);
+}
+
+static void benchAudioStream(uint32_t sampleCount) {
+    static uint8_t chunk[4800 * 4];
+    HcAudioInfo info = {HC_STRUCTURE_TYPE_AUDIO_INFO, NULL, HC_AUDIO_FORMAT_S16_PCM,
+                        HC_AUDIO_CHANNELS_STEREO, 48000};
+    HcAudioStreamBuffer* ring = NULL;
+    hcAudioOpenStream(&benchInstance, &info, &ring);
+    for (int i = 0; i < BENCH_SAMPLES; i++) {
+        uint64_t start = nowNs();
+        /* The core-side producer loop: watermark check, write, publish. */
+        uint32_t space = ring->frameCapacity - (ring->writeIndex - ring->readIndex);
+        if (space < sampleCount) {
+            ring->readIndex = ring->writeIndex; /* the bench drains instantly */
+        }
+        uint32_t slot = ring->writeIndex & (ring->frameCapacity - 1);
+        uint32_t untilWrap = ring->frameCapacity - slot;
+        uint32_t first = sampleCount < untilWrap ? sampleCount : untilWrap;
+        memcpy(ring->data + (size_t)slot * ring->frameSize, chunk, (size_t)first * ring->frameSize);
+        memcpy(ring->data, chunk + (size_t)first * ring->frameSize,
+               (size_t)(sampleCount - first) * ring->frameSize);
+        __atomic_store_n(&ring->writeIndex, ring->writeIndex + sampleCount, __ATOMIC_RELEASE);
+        latencySamples[i] = nowNs() - start;
+    }
+    hcAudioCloseStream(&benchInstance, ring);
+    char name[64];
+    snprintf(name, sizeof(name), "audio stream write %u frames", sampleCount);
+    report(name, latencySamples, BENCH_SAMPLES, (size_t)sampleCount * 4);
+}
+
+static void benchGetInputsBatched(void) {
+    enum { PORTS = 4, INPUTS = 20 };
+    static uint32_t ports[PORTS * INPUTS];
+    static HcInputType inputTypes[PORTS * INPUTS];
+    static int64_t values[PORTS * INPUTS];
+    for (int port = 0; port < PORTS; port++) {
+        for (int input = 0; input < INPUTS; input++) {
+            ports[port * INPUTS + input] = (uint32_t)port;
+            inputTypes[port * INPUTS + input] = (HcInputType)input;
+        }
+    }
+    for (int i = 0; i < BENCH_SAMPLES; i++) {
+        uint64_t start = nowNs();
+        hcGetInputsBatched(&benchInstance, ports, inputTypes, values, PORTS * INPUTS);
+        latencySamples[i] = nowNs() - start;
+    }
+    report("hcGetInputsBatched 4x20 inputs", latencySamples, BENCH_SAMPLES, 0);
+}
+
+static void benchGetInputsSync(void) {
+    /* 4 ports x 20 inputs, laid out the way a real core builds them: arrays of pointers. */
+    enum { PORTS = 4, INPUTS = 20 };
+    static HcInputRequest requestStorage[PORTS * INPUTS];
+    static const HcInputRequest* requests[PORTS * INPUTS];
+    static int64_t valueStorage[PORTS * INPUTS];
+    static const int64_t* values[PORTS * INPUTS];
+    for (int port = 0; port < PORTS; port++) {
+        for (int input = 0; input < INPUTS; input++) {
+            int i = port * INPUTS + input;
+            requestStorage[i].type = HC_STRUCTURE_TYPE_GET_INPUT_REQUEST;
+            requestStorage[i].next = NULL;
+            requestStorage[i].port = (uint32_t)port;
+            requestStorage[i].inputType = (HcInputType)input;
+            requests[i] = &requestStorage[i];
+            values[i] = &valueStorage[i];
+        }
+    }
+    for (int i = 0; i < BENCH_SAMPLES; i++) {
+        uint64_t start = nowNs();
+        hcGetInputsSync(&benchInstance, requests, PORTS * INPUTS, values);
+        latencySamples[i] = nowNs() - start;
+    }
+    report("hcGetInputsSync 4x20 inputs", latencySamples, BENCH_SAMPLES, 0);
+}
+
+int main(void) {
+    printf("hydra core API micro-benchmark, %d samples per bench\n\n", BENCH_SAMPLES);
+    benchLoadFunctionTable();
+
+    memset(frameSource, 0x5a, sizeof(frameSource));
+    benchSwPushVideoFrame(256, 224, HC_PIXEL_FORMAT_RGBA32, 4);
+    benchSwPushVideoFrame(640, 480, HC_PIXEL_FORMAT_RGBA32, 4);
+    benchSwPushVideoFrame(1920, 1080, HC_PIXEL_FORMAT_RGBA32, 4);
+    benchSwPushVideoFrame(1920, 1080, HC_PIXEL_FORMAT_RGB565, 2);
+    benchSwAcquirePresent(256, 224, 4);
+    benchSwAcquirePresent(1920, 1080, 4);
+
+    benchPushSamples(48);
+    benchPushSamples(480);
+    benchPushSamples(4800);
+    benchAudioStream(48);
+    benchAudioStream(480);
+    benchAudioStream(4800);
+
+    benchGetInputsSync();
+    benchGetInputsBatched();
+    return 0;
+}
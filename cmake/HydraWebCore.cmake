@@ -3,8 +3,12 @@
 macro(hydra_web_core)
     if (EMSCRIPTEN)
         set_property(GLOBAL PROPERTY TARGET_SUPPORTS_SHARED_LIBS TRUE)
-        set(CMAKE_SHARED_LIBRARY_CREATE_C_FLAGS "-s SIDE_MODULE=1")
-        set(CMAKE_SHARED_LIBRARY_CREATE_CXX_FLAGS "-s SIDE_MODULE=1")
+        # SHARED_MEMORY backs the HcWebTransportInfo SharedArrayBuffer transport and requires
+        # pthread-enabled objects, so both flags go to compile and link.
+        set(CMAKE_SHARED_LIBRARY_CREATE_C_FLAGS "-s SIDE_MODULE=1 -pthread -s SHARED_MEMORY=1")
+        set(CMAKE_SHARED_LIBRARY_CREATE_CXX_FLAGS "-s SIDE_MODULE=1 -pthread -s SHARED_MEMORY=1")
+        string(APPEND CMAKE_C_FLAGS " -pthread -s SHARED_MEMORY=1")
+        string(APPEND CMAKE_CXX_FLAGS " -pthread -s SHARED_MEMORY=1")
         set(CMAKE_SHARED_LIBRARY_SUFFIX_CXX ".wasm")
         set(CMAKE_STRIP FALSE)
     endif()
@@ -54,9 +54,12 @@
 #include <stdbool.h>
 
 #define HYDRA_CORE_MAJOR 0
-#define HYDRA_CORE_MINOR 1
+#define HYDRA_CORE_MINOR 2
 #define HYDRA_CORE_PATCH 0
 
+/// The packed API version exchanged in HcFrontendFunctionTable::version.
+#define HYDRA_CORE_VERSION ((HYDRA_CORE_MAJOR << 16) | HYDRA_CORE_MINOR)
+
 #ifndef HYDRA_API_EXPORT
 #if defined(_WIN32) || defined(__CYGWIN__) || defined(__MINGW32__)
 #ifdef __GNUC__
@@ -106,8 +109,17 @@ typedef enum HcResult {
     HC_ERROR_NOT_VULKAN_RENDERED, ///< The core is not Vulkan rendered.
     HC_ERROR_NOT_METAL_RENDERED, ///< The core is not Metal rendered.
     HC_ERROR_NOT_DIRECT3D_RENDERED, ///< The core is not Direct3D rendered.
-    HC_INTERNAL_ERROR_BAD_LOADFUNCTIONPTR = -5001, ///< The load function pointer is not valid during hcInternalLoadFunctions.
-    HC_INTERNAL_ERROR_MISSING_FUNCTION = -5002, ///< A function is missing during hcInternalLoadFunctions.
+    HC_ERROR_BAD_AUDIO_STREAM, ///< The audio stream is not valid or the requested stream configuration can't be satisfied.
+    HC_ERROR_BAD_INSTANCE, ///< The instance handle is not valid or was already destroyed.
+    HC_ERROR_BAD_STATE, ///< The state data is not valid or was saved by an incompatible core.
+    HC_ERROR_STATE_BUFFER_TOO_SMALL, ///< The caller-provided state buffer is smaller than hcGetStateSize reported.
+    HC_ERROR_UNSUPPORTED, ///< The called side doesn't support this optional operation — a frontend on
+                          ///< this platform (eg. shared GL contexts on the web) or a core (eg. no icon,
+                          ///< no asynchronous loading). Not a fault: the caller uses the fallback path.
+    HC_ERROR_BAD_LOCK, ///< The lock handle is not valid or was already destroyed.
+    HC_ERROR_BAD_STORAGE, ///< The storage region is not valid, not mapped, or can't be created.
+    HC_INTERNAL_ERROR_BAD_FUNCTION_TABLE = -5001, ///< The function table passed to hcInternalLoadFunctionTable is not valid, or its version doesn't match.
+    HC_INTERNAL_ERROR_MISSING_FUNCTION = -5002, ///< A function is missing during hcInternalLoadFunctionTable.
     HC_INTERNAL_ERROR_WRAPPER_NOT_INITIALIZED = -5003, ///< The wrapper is not initialized for whatever reason.
 } HcResult;
 
@@ -171,6 +183,33 @@ typedef enum HcStructureType {
     HC_STRUCTURE_TYPE_CALLBACKS,
     HC_STRUCTURE_TYPE_CONTENT_LOAD_INFO,
     HC_STRUCTURE_TYPE_ENVIRONMENT_INFO,
+    HC_STRUCTURE_TYPE_AUDIO_STREAM_BUFFER,
+    HC_STRUCTURE_TYPE_STATE_INFO,
+    HC_STRUCTURE_TYPE_STATE_DIRTY_RANGES_INFO,
+    HC_STRUCTURE_TYPE_CONTENT_MEMORY_INFO,
+    HC_STRUCTURE_TYPE_CONTENT_STREAM_INFO,
+    HC_STRUCTURE_TYPE_VULKAN_CONTEXT_INFO,
+    HC_STRUCTURE_TYPE_VULKAN_FRAME_INFO,
+    HC_STRUCTURE_TYPE_FRAME_COMPLETION_INFO,
+    HC_STRUCTURE_TYPE_PIXEL_FORMAT_NEGOTIATION_INFO,
+    HC_STRUCTURE_TYPE_DAMAGE_REGIONS_INFO,
+    HC_STRUCTURE_TYPE_SHARED_INPUT_STATE,
+    HC_STRUCTURE_TYPE_INPUT_EVENT_RING,
+    HC_STRUCTURE_TYPE_TURBO_INFO,
+    HC_STRUCTURE_TYPE_DISPLAY_TIMING_INFO,
+    HC_STRUCTURE_TYPE_CAPABILITY_INFO,
+    HC_STRUCTURE_TYPE_PERF_COUNTER_BLOCK,
+    HC_STRUCTURE_TYPE_CONTENT_LOAD_CALLBACKS,
+    HC_STRUCTURE_TYPE_WEB_TRANSPORT_INFO,
+    HC_STRUCTURE_TYPE_FRAME_INPUTS_INFO,
+    HC_STRUCTURE_TYPE_AUDIO_QUEUE_STATUS,
+    HC_STRUCTURE_TYPE_FRAME_RATE_INFO,
+    HC_STRUCTURE_TYPE_CONTENT_PROBE_INFO,
+    HC_STRUCTURE_TYPE_SHARED_RUN_STATE,
+    HC_STRUCTURE_TYPE_METAL_CONTEXT_INFO,
+    HC_STRUCTURE_TYPE_METAL_FRAME_INFO,
+    HC_STRUCTURE_TYPE_DIRECT3D_CONTEXT_INFO,
+    HC_STRUCTURE_TYPE_DIRECT3D_FRAME_INFO,
 } HcStructureType;
 
 typedef enum HcOpenGlVersion {
@@ -268,11 +307,57 @@ typedef enum HcAudioChannels {
     HC_AUDIO_CHANNELS_7_1_SURROUND = 8,
 } HcAudioChannels;
 
+typedef enum HcProbeConfidence {
+    HC_PROBE_CONFIDENCE_NO_MATCH = 0, ///< The content is definitely not for this core.
+    HC_PROBE_CONFIDENCE_EXTENSION_ONLY = 1, ///< Nothing in the header contradicts this core, but nothing confirms it either.
+    HC_PROBE_CONFIDENCE_LIKELY = 2, ///< The header structure looks right for this core.
+    HC_PROBE_CONFIDENCE_CERTAIN = 3, ///< A magic number or checksum positively identifies the content.
+} HcProbeConfidence;
+
 typedef enum HcResetType {
     HC_RESET_TYPE_SOFT = 1, ///< Whatever the core considers a soft reset, usually equivalent to pressing the reset button on the console.
     HC_RESET_TYPE_HARD = 2, ///< Whatever the core considers a hard reset, usually equivalent to turning the console off and on again.
 } HcResetType;
 
+/// Optional parts of the API a frontend can support, published once during hcCreate through
+/// HcCapabilityInfo so cores never have to discover support by calling something and getting an
+/// error back at runtime.
+typedef enum HcCapabilityFlags {
+    HC_CAPABILITY_SW_ACQUIRE_FRAME_BUFFER = 1 << 0, ///< hcSwAcquireFrameBuffer/hcSwPresentFrameBuffer work.
+    HC_CAPABILITY_AUDIO_STREAM = 1 << 1, ///< hcAudioOpenStream/hcAudioCloseStream work.
+    HC_CAPABILITY_VULKAN_RENDERING = 1 << 2, ///< HcVulkanContextInfo is chained and hcVkPushVideoFrame works.
+    HC_CAPABILITY_ASYNC_RUN_FRAME = 1 << 3, ///< The frontend calls runFrameAsync when the core provides it.
+    HC_CAPABILITY_PIXEL_FORMAT_NEGOTIATION = 1 << 4, ///< HcPixelFormatNegotiationInfo is chained.
+    HC_CAPABILITY_DAMAGE_REGIONS = 1 << 5, ///< The frontend honors HcDamageRegionsInfo on presented frames.
+    HC_CAPABILITY_SHARED_INPUT_STATE = 1 << 6, ///< HcSharedInputState is chained.
+    HC_CAPABILITY_INPUT_EVENT_RING = 1 << 7, ///< An HcInputEventRing is chained on the shared input state.
+    HC_CAPABILITY_TURBO = 1 << 8, ///< The frontend may request HC_RUN_STATE_TURBO.
+    HC_CAPABILITY_WAIT_FOR_DISPLAY = 1 << 9, ///< hcWaitForDisplay works.
+    HC_CAPABILITY_PERF_COUNTERS = 1 << 10, ///< An HcPerfCounterBlock is chained and read by the frontend.
+    HC_CAPABILITY_GL_SHARED_CONTEXTS = 1 << 11, ///< hcGlCreateSharedContext and friends work.
+    HC_CAPABILITY_WEB_SHARED_BUFFER = 1 << 12, ///< An HcWebTransportInfo is chained; see that struct.
+    HC_CAPABILITY_SHARED_RUN_STATE = 1 << 13, ///< An HcSharedRunState is chained and kept up to date.
+    HC_CAPABILITY_METAL_RENDERING = 1 << 14, ///< An HcMetalContextInfo is chained and hcMtlPushVideoFrame works.
+    HC_CAPABILITY_DIRECT3D_RENDERING = 1 << 15, ///< An HcDirect3DContextInfo is chained and hcD3dPushVideoFrame works.
+    HC_CAPABILITY_AUDIO_QUEUE_STATUS = 1 << 16, ///< hcGetAudioQueueStatus works.
+    HC_CAPABILITY_LOCKS = 1 << 17, ///< hcCreateLock and friends work.
+    HC_CAPABILITY_BATCHED_INPUT = 1 << 18, ///< hcGetInputsBatched works.
+    HC_CAPABILITY_STORAGE = 1 << 19, ///< hcStorageMap and friends work.
+} HcCapabilityFlags;
+
+typedef enum HcMemoryRegionFlags {
+    HC_MEMORY_REGION_FLAG_READ = 1 << 0, ///< The frontend may read the region.
+    HC_MEMORY_REGION_FLAG_WRITE = 1 << 1, ///< The frontend may write the region (eg. for cheats).
+    HC_MEMORY_REGION_FLAG_DIRTY_TRACKED = 1 << 2, ///< The region's dirtyCounter is maintained by the core.
+} HcMemoryRegionFlags;
+
+typedef enum HcStateType {
+    HC_STATE_TYPE_PORTABLE = 1, ///< A stable serialized state, suitable for saving to disk and loading in a future session.
+    HC_STATE_TYPE_VOLATILE = 2, ///< A fast in-memory snapshot that may skip serialization niceties. Only valid for the
+                                ///< lifetime of the loaded content and the core version that saved it. This is the tier
+                                ///< to use for run-ahead and rollback, where states are saved and restored every frame.
+} HcStateType;
+
 typedef enum HcInputType {
     HC_INPUT_TYPE_NULL = 0,
     // TODO: add input types (eg. HC_INPUT_TYPE_ANALOG1_HORIZONTAL or HC_INPUT_TYPE_BUTTON_X)
@@ -283,8 +368,20 @@ typedef enum HcRunState {
     HC_RUN_STATE_RUNNING = 1, ///< The core is running.
     HC_RUN_STATE_PAUSED = 2,  ///< The core is paused.
     HC_RUN_STATE_QUIT = 3,    ///< The core is stopped and will not be resumed.
+    HC_RUN_STATE_TURBO = 4,   ///< The core is fast-forwarding. The core may skip video rendering and audio
+                              ///< generation for frames the frontend will drop anyway; see HcTurboInfo.
 } HcRunState;
 
+/// An opaque handle to one instance of a running core, defined by the core.
+/// One loaded core image can serve multiple instances at the same time (picture-in-picture, netplay
+/// spectating, rollback shadow instances), sharing read-only code and content pages between them.
+/// Instances are created with hcCreate and destroyed with hcDestroy, and every per-instance call in
+/// either direction is tagged with the instance it belongs to so the frontend can route it to the
+/// right window, audio device and input source.
+typedef struct HcInstance_T* HcInstance;
+
+/// This structure allows for extensions: the core can chain an HcFrameRateInfo on `next` when the
+/// exact frame rate isn't a whole number.
 typedef struct HcVideoInfo {
     HcStructureType type;
     void* next;
@@ -292,10 +389,38 @@ typedef struct HcVideoInfo {
     uint32_t rendererVersion; ///< The version of the renderer the core wants to use.
     uint32_t width; ///< The width of the video output.
     uint32_t height; ///< The height of the video output.
-    uint32_t frameRate; ///< The frame rate of the video output, in frames per second.
+    uint32_t frameRate; ///< The frame rate of the video output, in frames per second, rounded to the
+                        ///< nearest integer. When an HcFrameRateInfo is chained, the exact rational
+                        ///< rate takes precedence for pacing.
     HcPixelFormat format; ///< The pixel format of the video output.
 } HcVideoInfo;
 
+/// Chained on HcVideoInfo::next by the core to give the frame rate as an exact rational, because
+/// the consoles being emulated rarely run at whole frame rates (59.7275 Hz, 60.0988 Hz, 60000/1001)
+/// and pacing against a rounded integer beats against real displays, dropping or doubling a frame
+/// every few seconds. Cores that switch video modes mid-game (interlaced/progressive) chain the new
+/// rate and call hcReconfigureEnvironment, so the frontend updates its pacing without a
+/// destroy/create cycle.
+typedef struct HcFrameRateInfo {
+    HcStructureType type;
+    void* next;
+    uint32_t numerator; ///< The frame rate numerator, eg. 60000.
+    uint32_t denominator; ///< The frame rate denominator, eg. 1001.
+} HcFrameRateInfo;
+
+/// Chained on HcEnvironmentInfo::next by the frontend during hcCreate. The frontend lists the pixel
+/// formats its GPU uploads at zero cost, most preferred first; the core picks the first one it can
+/// rasterize natively and declares it in HcVideoInfo::format, so in the common case no per-frame
+/// conversion pass exists on either side. A core that can't produce any listed format keeps its
+/// native format — HcVideoInfo::format always names what the core actually renders, so the frontend
+/// can do the unavoidable conversion on the GPU instead of a CPU swizzle.
+typedef struct HcPixelFormatNegotiationInfo {
+    HcStructureType type;
+    void* next;
+    const HcPixelFormat* preferredFormats; ///< The frontend's zero-cost upload formats, most preferred first.
+    uint32_t formatCount; ///< The number of entries in preferredFormats.
+} HcPixelFormatNegotiationInfo;
+
 typedef struct HcAudioInfo {
     HcStructureType type;
     void* next;
@@ -304,6 +429,28 @@ typedef struct HcAudioInfo {
     uint32_t sampleRate; ///< The sample rate of the audio output, in samples per second.
 } HcAudioInfo;
 
+/// A rectangle in image coordinates, with the origin in the top left corner.
+typedef struct HcRect {
+    uint32_t x;
+    uint32_t y;
+    uint32_t width;
+    uint32_t height;
+} HcRect;
+
+/// Chained on HcImageData::next by the core when presenting a frame where only part of the screen
+/// changed. The frontend then uploads just those rectangles with partial texture updates instead of
+/// the whole frame; a rectCount of zero means nothing changed and the frontend may skip the upload
+/// entirely. A frame without this extension is treated as fully damaged. The rectangles must not
+/// overlap and must cover every pixel that changed since the previously presented frame.
+typedef struct HcDamageRegionsInfo {
+    HcStructureType type;
+    void* next;
+    const HcRect* rects; ///< The changed rectangles, owned by the core, valid for the duration of the call.
+    uint32_t rectCount; ///< The number of entries in rects.
+} HcDamageRegionsInfo;
+
+/// This structure allows for extensions: the core can chain an HcDamageRegionsInfo on `next` so the
+/// frontend only uploads the parts of the frame that changed.
 typedef struct HcImageData {
     HcStructureType type;
     void* next;
@@ -324,6 +471,37 @@ typedef struct HcAudioData {
     HcAudioInfo have;
 } HcAudioData;
 
+/// A lock-free single-producer single-consumer ring shared between the core and the frontend's audio thread.
+/// The ring is allocated and owned by the frontend and handed to the core by hcAudioOpenStream.
+/// The core is the only writer of `writeIndex` and the frontend's audio thread is the only writer of `readIndex`.
+/// Both indices are free-running frame counters that are only reduced modulo `frameCapacity` when indexing `data`,
+/// so the current fill level is always `writeIndex - readIndex`.
+/// The core should check the fill level before writing instead of relying on a per-push error:
+/// writing more than `frameCapacity - (writeIndex - readIndex)` frames is an overrun and the excess is lost.
+/// Index updates must be made visible with release semantics and read with acquire semantics.
+typedef struct HcAudioStreamBuffer {
+    HcStructureType type;
+    void* next;
+    uint8_t* data; ///< The ring storage, sized frameCapacity * frameSize bytes.
+    uint32_t frameCapacity; ///< The capacity of the ring in frames. Always a power of two.
+    uint32_t frameSize; ///< The size of one frame in bytes, so sample size * channel count.
+    uint32_t writeIndex; ///< Free-running count of frames written. Written only by the core.
+    uint32_t readIndex; ///< Free-running count of frames consumed. Written only by the frontend.
+    HcAudioInfo info; ///< The negotiated stream format, filled by the frontend.
+} HcAudioStreamBuffer;
+
+/// Filled by hcGetAudioQueueStatus: a snapshot of the frontend's audio queue and device clock, so
+/// cores see pressure coming and adapt instead of losing chunks to HC_ERROR_AUDIO_OVERRUN.
+typedef struct HcAudioQueueStatus {
+    HcStructureType type;
+    void* next;
+    uint32_t fillFrames; ///< Frames currently queued ahead of the device.
+    uint32_t capacityFrames; ///< The capacity of the frontend's queue in frames.
+    uint32_t deviceLatencyFrames; ///< Additional latency between the queue and the speaker, in frames.
+    int32_t driftPpm; ///< The estimated drift between the core's sample production rate and the
+                      ///< device clock, in parts per million. Positive means the queue is growing.
+} HcAudioQueueStatus;
+
 typedef struct HcContentInfo {
     HcStructureType type;
     void* next;
@@ -345,9 +523,14 @@ typedef struct HcCoreInfo {
     const char* license;
     HcContentInfo* loadableContentInfo;
     int loadableContentInfoCount;
-    HcImageData* icon;
+    HcImageData* icon; ///< May be NULL. Prefer hcGetCoreIcon, which decodes lazily and at the size
+                       ///< actually needed, so enumerating installed cores touches only strings.
 } HcCoreInfo;
 
+/// This structure allows for extensions: the frontend chains what it offers the instance on `next`
+/// before calling hcCreate — an HcCapabilityInfo, renderer contexts (HcVulkanContextInfo,
+/// HcMetalContextInfo, HcDirect3DContextInfo), an HcPixelFormatNegotiationInfo, an
+/// HcSharedInputState, an HcSharedRunState, an HcPerfCounterBlock, or an HcWebTransportInfo.
 typedef struct HcEnvironmentInfo {
     HcStructureType type;
     void* next;
@@ -356,6 +539,149 @@ typedef struct HcEnvironmentInfo {
     HcAudioInfo* const audio;
 } HcEnvironmentInfo;
 
+/// Chained on HcEnvironmentInfo::next by the frontend during hcCreate for cores that declared
+/// ::HC_RENDERER_TYPE_VULKAN. The core renders on the frontend's shared device and submits on the
+/// given queue family, so frames never leave the GPU. Handles are passed as plain pointers so this
+/// header doesn't depend on vulkan.h; cast them to the corresponding Vk types.
+typedef struct HcVulkanContextInfo {
+    HcStructureType type;
+    void* next;
+    void* instance; ///< The frontend's VkInstance.
+    void* physicalDevice; ///< The VkPhysicalDevice the device was created from.
+    void* device; ///< The VkDevice shared between the frontend and the core.
+    uint32_t queueFamilyIndex; ///< The queue family the core may submit on.
+    uint32_t queueIndex; ///< The queue index within that family reserved for the core.
+    /// The frontend loader's vkGetInstanceProcAddr, for the core to load every other Vulkan function from.
+    void* (HYDRA_API_CALL *getInstanceProcAddr)(void* instance, const char* name);
+} HcVulkanContextInfo;
+
+/// A rendered frame exported by a Vulkan core through hcVkPushVideoFrame. The image was allocated
+/// from the shared device, so the frontend composites it with zero copies; synchronization uses a
+/// timeline semaphore instead of a full pipeline flush per frame.
+typedef struct HcVulkanFrameInfo {
+    HcStructureType type;
+    void* next;
+    void* image; ///< The VkImage holding the frame.
+    uint32_t imageLayout; ///< The VkImageLayout the image is in once waitValue is signaled.
+    uint32_t format; ///< The VkFormat of the image.
+    uint32_t width; ///< The width of the frame.
+    uint32_t height; ///< The height of the frame.
+    void* timelineSemaphore; ///< The VkSemaphore (timeline) guarding the image.
+    uint64_t waitValue; ///< The frontend waits for this value before reading the image.
+    uint64_t signalValue; ///< The frontend signals this value once it is done, so the core can reuse the image.
+} HcVulkanFrameInfo;
+
+/// Well-known slots in an HcPerfCounterBlock. Slots below ::HC_PERF_COUNTER_CUSTOM_BASE have fixed
+/// meanings; the rest are core-defined and named through HcPerfCounterBlock::customNames.
+typedef enum HcPerfCounterSlot {
+    HC_PERF_COUNTER_FRAME_EMULATE_NS = 0, ///< Total nanoseconds spent emulating frames.
+    HC_PERF_COUNTER_VIDEO_PUSH_NS = 1, ///< Total nanoseconds spent handing video frames to the frontend.
+    HC_PERF_COUNTER_AUDIO_PUSH_NS = 2, ///< Total nanoseconds spent handing audio to the frontend.
+    HC_PERF_COUNTER_INPUT_WAIT_NS = 3, ///< Total nanoseconds spent waiting on input.
+    HC_PERF_COUNTER_CUSTOM_BASE = 16, ///< The first core-defined slot.
+} HcPerfCounterSlot;
+
+/// Chained on HcEnvironmentInfo::next by the frontend during hcCreate when it wants telemetry.
+/// `counters` is a frontend-owned block of monotonically increasing values the core updates with
+/// plain relaxed stores — no callbacks, no locks — which the frontend's telemetry thread samples at
+/// its own rate. Counters only ever increase, so the sampler diffs successive reads to get rates.
+/// When the block isn't chained (or the capability isn't acknowledged) cores skip the
+/// instrumentation entirely and the hot path pays nothing.
+/// The frontend keeps the block and its `counters` and `customNames` storage valid until the
+/// instance is destroyed; the core may retain the pointers past hcCreate.
+typedef struct HcPerfCounterBlock {
+    HcStructureType type;
+    void* next;
+    uint64_t* counters; ///< counterCount monotonically increasing values, written only by the core.
+    uint32_t counterCount; ///< The number of slots. At least ::HC_PERF_COUNTER_CUSTOM_BASE.
+    const char** customNames; ///< Frontend-allocated array of counterCount entries. The core writes a
+                              ///< name into each custom slot it uses and leaves unused entries NULL.
+} HcPerfCounterBlock;
+
+/// Chained on HcEnvironmentInfo::next by the frontend during hcCreate. The frontend publishes the
+/// capabilities it supports; the core fills `used` (a subset of `supported`) with the ones it will
+/// actually rely on, before hcCreate returns. This lets the core select its hot paths once at
+/// create — eg. pick the zero-copy video routine — instead of branching on frontend support inside
+/// per-frame code, and lets the frontend skip setting up machinery the core won't touch.
+/// Capabilities the frontend doesn't list behave as before: the corresponding call fails with its
+/// usual error.
+typedef struct HcCapabilityInfo {
+    HcStructureType type;
+    void* next;
+    uint64_t supported; ///< A combination of HcCapabilityFlags, filled by the frontend.
+    uint64_t used; ///< A combination of HcCapabilityFlags, filled by the core. Must be a subset of supported.
+} HcCapabilityInfo;
+
+/// Chained on HcEnvironmentInfo::next by web frontends (negotiated through
+/// ::HC_CAPABILITY_WEB_SHARED_BUFFER). The rings live inside one SharedArrayBuffer, so the
+/// AudioWorklet and the WebGL uploader on the JS side consume frames and samples directly from the
+/// core's memory — delivery without any JS-side copy, instead of pushing every byte across the WASM
+/// heap boundary through hcSwPushVideoFrame/hcPushSamples. A core that acknowledges the capability
+/// writes into these rings and stops calling the push imports for video and audio.
+/// The video ring follows the same free-running SPSC index discipline as HcAudioStreamBuffer, with
+/// the core producing whole frame slots and the uploader consuming them.
+/// The frontend keeps the block, the `videoRing` storage and the `audio` ring valid until the
+/// instance is destroyed; the core may retain the pointers past hcCreate.
+typedef struct HcWebTransportInfo {
+    HcStructureType type;
+    void* next;
+    uint8_t* videoRing; ///< videoFrameCapacity slots of videoFrameSize bytes each.
+    uint32_t videoFrameCapacity; ///< The capacity of the video ring in frames. Always a power of two.
+    uint32_t videoFrameSize; ///< The size of one frame slot in bytes (stride * height of the video mode).
+    uint32_t videoWriteIndex; ///< Free-running count of frames written. Written only by the core.
+    uint32_t videoReadIndex; ///< Free-running count of frames uploaded. Written only by the frontend.
+    HcAudioStreamBuffer* audio; ///< The audio ring, also inside the SharedArrayBuffer.
+} HcWebTransportInfo;
+
+/// Metal counterpart of HcVulkanContextInfo, chained on HcEnvironmentInfo::next by the frontend
+/// during hcCreate for cores that declared ::HC_RENDERER_TYPE_METAL. Handles are passed as plain
+/// pointers so this header doesn't depend on the Metal headers; cast them to the Objective-C types.
+typedef struct HcMetalContextInfo {
+    HcStructureType type;
+    void* next;
+    void* device; ///< The MTLDevice shared between the frontend and the core.
+    void* commandQueue; ///< An MTLCommandQueue reserved for the core's submissions.
+    void* layer; ///< The CAMetalLayer the frontend composites; the core may request drawables from it.
+} HcMetalContextInfo;
+
+/// A rendered frame exported by a Metal core through hcMtlPushVideoFrame, synchronized with a
+/// shared event so the frontend composites it without a GPU->CPU->GPU round trip.
+typedef struct HcMetalFrameInfo {
+    HcStructureType type;
+    void* next;
+    void* texture; ///< The MTLTexture holding the frame, allocated from the shared device.
+    uint32_t width; ///< The width of the frame.
+    uint32_t height; ///< The height of the frame.
+    void* sharedEvent; ///< The MTLSharedEvent guarding the texture.
+    uint64_t waitValue; ///< The frontend waits for this value before reading the texture.
+    uint64_t signalValue; ///< The frontend signals this value once it is done, so the core can reuse the texture.
+} HcMetalFrameInfo;
+
+/// Direct3D counterpart of HcVulkanContextInfo, chained on HcEnvironmentInfo::next by the frontend
+/// during hcCreate for cores that declared ::HC_RENDERER_TYPE_DIRECT3D. Exactly one of
+/// deviceContext (D3D11) and commandQueue (D3D12) is set, matching the rendererVersion the core
+/// asked for.
+typedef struct HcDirect3DContextInfo {
+    HcStructureType type;
+    void* next;
+    void* device; ///< The ID3D11Device or ID3D12Device shared between the frontend and the core.
+    void* deviceContext; ///< The ID3D11DeviceContext. NULL on D3D12.
+    void* commandQueue; ///< The ID3D12CommandQueue reserved for the core. NULL on D3D11.
+} HcDirect3DContextInfo;
+
+/// A rendered frame exported by a Direct3D core through hcD3dPushVideoFrame: a shared-handle
+/// texture on the common device, fence-synchronized so the frontend composites it with zero copies.
+typedef struct HcDirect3DFrameInfo {
+    HcStructureType type;
+    void* next;
+    void* texture; ///< The shared-handle ID3D11Texture2D or ID3D12Resource holding the frame.
+    uint32_t width; ///< The width of the frame.
+    uint32_t height; ///< The height of the frame.
+    void* fence; ///< The shared ID3D11Fence/ID3D12Fence guarding the texture.
+    uint64_t waitValue; ///< The frontend waits for this value before reading the texture.
+    uint64_t signalValue; ///< The frontend signals this value once it is done, so the core can reuse the texture.
+} HcDirect3DFrameInfo;
+
 typedef struct HcDestroyInfo {
     HcStructureType type;
     void* next;
@@ -381,6 +707,49 @@ typedef struct HcHostInfo {
     HcDirect3DVersion direct3DVersion;
 } HcHostInfo;
 
+/// Chained on HcEnvironmentInfo::next by the frontend during hcCreate when it supports push-mode
+/// input delivery. The frontend writes input state changes into this block as they happen and the
+/// core reads it wait-free mid-frame, instead of blocking on hcGetInputsSync once per frame — the
+/// difference between a frame of input latency and near zero. The block is seqlock-protected:
+/// the frontend increments `sequence` to an odd value before updating `values` — that store happens
+/// before the value writes — and to an even value after, with release semantics so the value writes
+/// are visible first. The core reads `sequence` with acquire semantics, reads the values it needs,
+/// re-reads `sequence` with acquire semantics, and retries if the two reads differ or were odd; the
+/// acquire pairing is what makes a stable even pair guarantee untorn values on weakly-ordered
+/// hosts. Cores ignoring this block keep polling hcGetInputsSync.
+/// The frontend keeps the block and its `values` storage (and any chained HcInputEventRing with its
+/// `events` storage) valid until the instance is destroyed; the core may retain the pointers past
+/// hcCreate.
+typedef struct HcSharedInputState {
+    HcStructureType type;
+    void* next; ///< The frontend can chain an HcInputEventRing here.
+    uint32_t sequence; ///< Seqlock counter, written only by the frontend. Odd while an update is in progress.
+    uint32_t portCount; ///< The number of input ports in the block.
+    uint32_t inputsPerPort; ///< The number of values per port, indexed by HcInputType.
+    const int64_t* values; ///< portCount * inputsPerPort values, indexed port * inputsPerPort + inputType.
+} HcSharedInputState;
+
+/// A single input state change, timestamped for cores that want sub-frame input timing.
+typedef struct HcInputEvent {
+    uint64_t timestampNs; ///< When the change happened, on the host's monotonic clock.
+    uint32_t port; ///< The port the input belongs to.
+    HcInputType inputType; ///< The input that changed.
+    int64_t value; ///< The new value of the input.
+} HcInputEvent;
+
+/// An optional edge-event ring the frontend chains on HcSharedInputState::next. It is a lock-free
+/// single-producer single-consumer ring with the same index discipline as HcAudioStreamBuffer, with
+/// the roles reversed: the frontend is the producer and the core is the consumer. When the ring
+/// overflows the frontend drops the oldest events; the shared state block always holds the latest values.
+typedef struct HcInputEventRing {
+    HcStructureType type;
+    void* next;
+    HcInputEvent* events; ///< The ring storage, capacity entries. Always a power of two.
+    uint32_t capacity; ///< The capacity of the ring in events.
+    uint32_t writeIndex; ///< Free-running count of events written. Written only by the frontend.
+    uint32_t readIndex; ///< Free-running count of events consumed. Written only by the core.
+} HcInputEventRing;
+
 typedef struct HcInputRequest {
     HcStructureType type;
     void* next;
@@ -388,12 +757,119 @@ typedef struct HcInputRequest {
     HcInputType inputType;
 } HcInputRequest;
 
+/// An opaque handle to a lightweight lock vended by the frontend through hcCreateLock.
+/// Defined by the frontend.
+typedef struct HcLock_T* HcLock;
+
+typedef enum HcLockFlags {
+    HC_LOCK_FLAG_NONE = 0,
+    HC_LOCK_FLAG_PRIORITY_INHERIT = 1 << 0, ///< Request priority inheritance where the OS supports it.
+} HcLockFlags;
+
+/// A request for a frontend-vended lock, passed to hcCreateLock. Cores and frontends use these for
+/// the shared hot-path resources they both touch — GL context handoff, audio buffers, run-state
+/// changes — instead of each core inventing its own synchronization. The locks are backed by
+/// futex-class primitives (futex, WaitOnAddress, ulock), so waiters sleep instead of spinning
+/// against the frontend's render thread, and ::HC_LOCK_FLAG_PRIORITY_INHERIT avoids the priority
+/// inversions ad-hoc spinlocks cause.
+typedef struct HcLockRequest {
+    HcStructureType type;
+    void* next;
+    uint32_t flags; ///< A combination of HcLockFlags.
+    const char* name; ///< An optional debug name for the lock. May be NULL.
+} HcLockRequest;
+
+/// Chained on HcEnvironmentInfo::next by the frontend during hcCreate. The frontend mirrors every
+/// run-state change into this block — it stores runState first, then increments epoch with release
+/// semantics — so cores check for pause/quit with a single relaxed load of `epoch` in their
+/// innermost loop (even per scanline). When the relaxed load sees the epoch move, the core re-reads
+/// `epoch` with acquire semantics before reading `runState`; the acquire pairs with the frontend's
+/// release and guarantees the new state is observed. hcSetRunState
+/// is still called on every change, but it becomes the wake mechanism — eg. for a core blocked in
+/// hcWaitForDisplay — rather than the data path.
+/// The frontend keeps the block valid until the instance is destroyed; the core may retain the
+/// pointer past hcCreate.
+typedef struct HcSharedRunState {
+    HcStructureType type;
+    void* next;
+    HcRunState runState; ///< The current run state. Written only by the frontend.
+    uint32_t epoch; ///< Monotonically increasing change counter. Written only by the frontend,
+                    ///< incremented after runState is updated.
+} HcSharedRunState;
+
+/// Filled by hcWaitForDisplay when the display's composition deadline is reached, so self-driven
+/// cores pace against the frontend's presentation clock instead of their own sleep or spin loops.
+typedef struct HcDisplayTimingInfo {
+    HcStructureType type;
+    void* next;
+    uint64_t timestampNs; ///< When the wait actually returned, on the host's monotonic clock.
+    uint64_t refreshPeriodNs; ///< The display's current refresh period. Tracks VRR changes.
+} HcDisplayTimingInfo;
+
+/// This structure allows for extensions: chain an HcTurboInfo on `next` together with
+/// ::HC_RUN_STATE_TURBO to tell the core how fast the frontend wants to run.
 typedef struct HcRunStateInfo {
     HcStructureType type;
     void* next;
     HcRunState runState;
 } HcRunStateInfo;
 
+/// Chained on HcRunStateInfo::next when entering ::HC_RUN_STATE_TURBO. Under turbo the frontend
+/// only displays roughly every speedMultiplier-th frame, so the core is free to skip rasterization
+/// and audio generation for the frames in between — which is most of their cost — instead of fully
+/// rendering frames that get thrown away. Emulation itself must still run every frame.
+typedef struct HcTurboInfo {
+    HcStructureType type;
+    void* next;
+    uint32_t speedMultiplier; ///< The target speed as a multiple of real time. 0 means uncapped.
+} HcTurboInfo;
+
+/// A named region of emulated memory the frontend may access in place, for cheat and achievement
+/// scanners that would otherwise need the core to copy guest RAM out every frame.
+typedef struct HcMemoryRegion {
+    const char* name; ///< A stable name for the region, eg. "wram" or "vram".
+    uint8_t* base; ///< The region's memory. Reads may race the emulation thread and see torn values.
+    size_t size; ///< The size of the region in bytes.
+    uint32_t flags; ///< A combination of HcMemoryRegionFlags.
+    uint32_t dirtyGranularity; ///< The granularity of dirty tracking in bytes. 0 when not tracked.
+    const uint32_t* dirtyCounters; ///< One counter per dirtyGranularity-sized granule of the region,
+                                   ///< (size + dirtyGranularity - 1) / dirtyGranularity entries in total.
+                                   ///< The core increments a granule's counter whenever that granule is
+                                   ///< written, so scanners skip granules whose counter hasn't moved.
+                                   ///< A core that only tracks the region as a whole sets
+                                   ///< dirtyGranularity == size, leaving a single counter.
+                                   ///< NULL when not tracked.
+} HcMemoryRegion;
+
+typedef struct HcStateInfo {
+    HcStructureType type;
+    void* next; ///< Can chain an HcStateDirtyRangesInfo on save.
+    HcStateType stateType;
+    uint8_t* data; ///< Caller-provided arena the state is saved into or loaded from. The core never allocates.
+    size_t size; ///< On save: the capacity of data, updated by the core to the number of bytes written.
+                 ///< On load: the size of the state in data.
+} HcStateInfo;
+
+/// A half-open byte range [offset, offset + length) into a saved state arena.
+typedef struct HcStateDirtyRange {
+    size_t offset;
+    size_t length;
+} HcStateDirtyRange;
+
+/// Chained on HcStateInfo::next by the caller when saving ::HC_STATE_TYPE_VOLATILE states into the same
+/// arena every frame. The core then only rewrites the bytes that changed since its previous save into
+/// that arena and reports the touched ranges, so successive per-frame snapshots cost a fraction of a
+/// full state write. Cores that don't track dirty state write everything and report one full-size range.
+typedef struct HcStateDirtyRangesInfo {
+    HcStructureType type;
+    void* next;
+    HcStateDirtyRange* ranges; ///< Caller-allocated array the core fills with the ranges it rewrote.
+    uint32_t rangeCapacity; ///< The number of entries in ranges.
+    uint32_t rangeCount; ///< Set by the core. If the ranges don't fit, the core coalesces them.
+} HcStateDirtyRangesInfo;
+
+/// This structure allows for extensions: the frontend can chain an HcContentMemoryInfo or an
+/// HcContentStreamInfo on `next` so the core doesn't have to open and read `path` itself.
 typedef struct HcContentLoadInfo {
     HcStructureType type;
     void* next;
@@ -401,16 +877,114 @@ typedef struct HcContentLoadInfo {
     const char* path;
 } HcContentLoadInfo;
 
+/// The first bytes of a file for hcProbeContent to identify. The buffer is read, owned and filled
+/// by the frontend; the core does no I/O of its own.
+typedef struct HcContentProbeInfo {
+    HcStructureType type;
+    void* next;
+    const char* name; ///< The file name, including its extension.
+    const uint8_t* data; ///< The first bytes of the file.
+    size_t size; ///< The number of bytes in data. Frontends should pass at least 4 KB where the file has them.
+} HcContentProbeInfo;
+
+/// Callbacks for hcLoadContentAsync, provided by the frontend. The structure must stay valid until
+/// `complete` has been called. The core may invoke the callbacks from any thread.
+typedef struct HcContentLoadCallbacks {
+    HcStructureType type;
+    void* next;
+    void* userdata; ///< Passed back to every callback unchanged.
+    /// Reports load progress. Optional, may be NULL.
+    void (HYDRA_API_CALL *progress)(void* userdata, uint64_t loadedBytes, uint64_t totalBytes);
+    /// Called at most once, when enough content is loaded for the core to start emitting frames.
+    /// From this point the frontend may run the instance while the rest loads in the background.
+    /// Optional, may be NULL; cores that can't start early never call it.
+    void (HYDRA_API_CALL *playable)(void* userdata);
+    /// Called exactly once when the load finishes or fails, with the result hcLoadContent would
+    /// have returned.
+    void (HYDRA_API_CALL *complete)(void* userdata, HcResult result);
+} HcContentLoadCallbacks;
+
+/// Chained on HcContentLoadInfo::next by the frontend to hand the core a read-only view of the
+/// content, typically a memory mapping of the file. The core reads the content in place and the
+/// operating system demand-pages it, so a multi-gigabyte disc image doesn't have to be read into
+/// RAM up front. The view stays valid until the content is unloaded or the instance is destroyed,
+/// and one mapping can be shared by every instance that loads the same content.
+typedef struct HcContentMemoryInfo {
+    HcStructureType type;
+    void* next;
+    const uint8_t* data; ///< The content bytes. Read-only.
+    size_t size; ///< The size of the content in bytes.
+} HcContentMemoryInfo;
+
+/// Chained on HcContentLoadInfo::next by the frontend to let the core pull content on demand,
+/// for content too large to map or still being downloaded. The core calls `read` with the ranges
+/// it needs and can start executing before the whole image is available.
+typedef struct HcContentStreamInfo {
+    HcStructureType type;
+    void* next;
+    void* userdata; ///< Passed back to `read` unchanged.
+    uint64_t size; ///< The total size of the content in bytes.
+    /// Read `length` bytes starting at `offset` into `buffer`. Returns the number of bytes read,
+    /// which is only less than `length` at the end of the content, or `(size_t)-1` when the range
+    /// can't be delivered at all (an I/O or network failure) — the core then fails the operation it
+    /// needed the data for, typically with ::HC_ERROR_BAD_CONTENT. Blocks until the range is
+    /// available or known to be unavailable; it never blocks forever on a dead source.
+    size_t (HYDRA_API_CALL *read)(void* userdata, uint64_t offset, size_t length, uint8_t* buffer);
+} HcContentStreamInfo;
+
+typedef enum HcRunFrameFlags {
+    HC_RUN_FRAME_FLAG_NONE = 0,
+    HC_RUN_FRAME_FLAG_RESIMULATION = 1 << 0, ///< The frame is a rollback re-run: the core must skip video
+                                             ///< and audio output entirely, so re-running 5-7 frames costs
+                                             ///< a fraction of a normal frame.
+} HcRunFrameFlags;
+
+/// The complete input vector for one frame, passed to runFrameWithInputs so the core never calls
+/// hcGetInputsSync for it. The three arrays are flat and caller-allocated: entry i says input
+/// inputTypes[i] on port ports[i] has value values[i] for the whole frame.
+typedef struct HcFrameInputsInfo {
+    HcStructureType type;
+    void* next;
+    uint32_t flags; ///< A combination of HcRunFrameFlags.
+    const uint32_t* ports; ///< The port of each entry.
+    const HcInputType* inputTypes; ///< The input of each entry.
+    const int64_t* values; ///< The value of each entry.
+    uint32_t inputCount; ///< The number of entries in the three arrays.
+} HcFrameInputsInfo;
+
+/// A completion fence the frontend passes to runFrameAsync. It stays valid until `signal` has been
+/// called; the core calls `signal(userdata)` exactly once, from whichever thread finishes the frame.
+typedef struct HcFrameCompletionInfo {
+    HcStructureType type;
+    void* next;
+    void* userdata; ///< Passed back to `signal` unchanged.
+    void (HYDRA_API_CALL *signal)(void* userdata); ///< Signals the frontend that the frame is done.
+} HcFrameCompletionInfo;
+
 typedef struct HcFrontendDrivenCallbacks {
     HcStructureType type;
     void* next;
-    void (*runFrame)();
+    void (*runFrame)(HcInstance instance);
+    /// Optional pipelined variant of runFrame; may be NULL if the core only runs synchronously.
+    /// The core kicks off emulation of the next frame (typically on its own thread) and returns
+    /// immediately, then signals the completion fence when the frame is done. This lets the
+    /// frontend overlap frame N's texture upload and present with frame N+1's emulation instead of
+    /// stalling its render thread for the whole frame. The frontend never has more than one
+    /// runFrameAsync in flight per instance.
+    void (*runFrameAsync)(HcInstance instance, const HcFrameCompletionInfo* completion);
+    /// Optional, for rollback netplay; may be NULL. Runs one frame with the given explicit input
+    /// vector instead of pulling inputs from the frontend. A core that provides this callback
+    /// thereby declares deterministic execution: from identical state, identical input vectors
+    /// produce identical successor states (and identical saved states), which is what makes
+    /// rollback and run-ahead correct. With HC_RUN_FRAME_FLAG_RESIMULATION set the core skips
+    /// video and audio output for the frame.
+    void (*runFrameWithInputs)(HcInstance instance, const HcFrameInputsInfo* inputs);
 } HcFrontendDrivenCallbacks;
 
 typedef struct HcSelfDrivenCallbacks {
     HcStructureType type;
     void* next;
-    void (*entryPoint)();
+    void (*entryPoint)(HcInstance instance);
 } HcSelfDrivenCallbacks;
 
 typedef struct HcCallbacks {
@@ -437,16 +1011,34 @@ extern HcGetHostInfoPtr hcGetHostInfo;
     @return ::HC_SUCCESS
     @return ::HC_ERROR_BAD_INPUT_REQUEST
 */
-typedef HcResult (HYDRA_API_CALL *HcGetInputsSyncPtr)(const HcInputRequest* const* requests, int requestCount, const int64_t* const* values);
+typedef HcResult (HYDRA_API_CALL *HcGetInputsSyncPtr)(HcInstance instance, const HcInputRequest* const* requests, int requestCount, const int64_t* const* values);
 extern HcGetInputsSyncPtr hcGetInputsSync;
 
+/**
+    Batched structure-of-arrays variant of hcGetInputsSync. The three arrays are flat and
+    caller-allocated — the same layout HcFrameInputsInfo uses — so the frontend fills values with a
+    single linear sweep over its internal input state instead of chasing two pointers per input,
+    which for 4 ports x 20 inputs per frame turns 160 dependent loads into three streaming arrays.
+    hcGetInputsSync stays for cores that only query a handful of inputs.
+    @param ports The port of each entry.
+    @param inputTypes The input of each entry.
+    @param values Will be filled with the value of each entry.
+    @param inputCount The number of entries in the three arrays.
+    @return ::HC_SUCCESS
+    @return ::HC_ERROR_BAD_INPUT_REQUEST
+*/
+typedef HcResult (HYDRA_API_CALL *HcGetInputsBatchedPtr)(HcInstance instance, const uint32_t* ports, const HcInputType* inputTypes, int64_t* values, uint32_t inputCount);
+extern HcGetInputsBatchedPtr hcGetInputsBatched;
+
 /**
     Reconfigure the environment the core is running in, for example when the window is resized or the frame rate changes in frontend-driven cores.
+    A core that changes video modes mid-game chains an HcFrameRateInfo with the new exact rate on
+    the video info, so the frontend repaces without destroying the instance.
     @param environmentInfo Information about the new environment. Renderer changes are ignored.
     @return ::HC_SUCCESS
     @return ::HC_ERROR_BAD_ENVIRONMENT_INFO
 */
-typedef HcResult (HYDRA_API_CALL *HcReconfigureEnvironmentPtr)(const HcEnvironmentInfo* environmentInfo);
+typedef HcResult (HYDRA_API_CALL *HcReconfigureEnvironmentPtr)(HcInstance instance, const HcEnvironmentInfo* environmentInfo);
 extern HcReconfigureEnvironmentPtr hcReconfigureEnvironment;
 
 /**
@@ -459,25 +1051,90 @@ extern HcReconfigureEnvironmentPtr hcReconfigureEnvironment;
     @return ::HC_ERROR_AUDIO_OVERRUN
     @return ::HC_ERROR_FULLY_SELF_DRIVEN
 */
-typedef HcResult (HYDRA_API_CALL *HcPushSamplesPtr)(const HcAudioData* audioData);
+typedef HcResult (HYDRA_API_CALL *HcPushSamplesPtr)(HcInstance instance, const HcAudioData* audioData);
 extern HcPushSamplesPtr hcPushSamples;
 
+/**
+    For not fully self-driven cores, this function is called by the core to open an audio stream once,
+    instead of paying a cross-module call and a want/have validation on every hcPushSamples.
+    The frontend validates the requested format a single time and returns a shared lock-free
+    single-producer single-consumer ring (see HcAudioStreamBuffer) that its audio thread drains directly.
+    The ring stays valid until it is handed back with hcAudioCloseStream.
+    @param info The audio format the core wants to produce.
+    @param stream Will be set to the frontend-owned ring the core writes samples into.
+    @return ::HC_SUCCESS
+    @return ::HC_ERROR_BAD_AUDIO_STREAM
+    @return ::HC_ERROR_AUDIO_FULLY_SELF_DRIVEN
+*/
+typedef HcResult (HYDRA_API_CALL *HcAudioOpenStreamPtr)(HcInstance instance, const HcAudioInfo* info, HcAudioStreamBuffer** stream);
+extern HcAudioOpenStreamPtr hcAudioOpenStream;
+
+/**
+    Close an audio stream previously opened with hcAudioOpenStream.
+    After this call the ring belongs to the frontend again and the core must not touch it.
+    @param stream The stream to close.
+    @return ::HC_SUCCESS
+    @return ::HC_ERROR_BAD_AUDIO_STREAM
+*/
+typedef HcResult (HYDRA_API_CALL *HcAudioCloseStreamPtr)(HcInstance instance, HcAudioStreamBuffer* stream);
+extern HcAudioCloseStreamPtr hcAudioCloseStream;
+
+/**
+    For not fully self-driven cores, this function snapshots the frontend's audio queue: fill level,
+    device latency and estimated clock drift. Cores use it for dynamic rate control — resampling by
+    a fraction of a percent to track the device clock — which keeps audio crackle-free without the
+    latency cost of overbuffering, instead of reacting to dropped chunks after the fact.
+    @param status Will be filled with the current queue status.
+    @return ::HC_SUCCESS
+    @return ::HC_ERROR_AUDIO_FULLY_SELF_DRIVEN
+*/
+typedef HcResult (HYDRA_API_CALL *HcGetAudioQueueStatusPtr)(HcInstance instance, HcAudioQueueStatus* status);
+extern HcGetAudioQueueStatusPtr hcGetAudioQueueStatus;
+
 /**
     For software rendered cores, this function is called by the core to push a video frame to the frontend.
     @param image The image data to push to the frontend.
     @return ::HC_SUCCESS
     @return ::HC_ERROR_NOT_SOFTWARE_RENDERED
 */
-typedef HcResult (HYDRA_API_CALL *HcSwPushVideoFramePtr)(const HcImageData* image);
+typedef HcResult (HYDRA_API_CALL *HcSwPushVideoFramePtr)(HcInstance instance, const HcImageData* image);
 extern HcSwPushVideoFramePtr hcSwPushVideoFrame;
 
+/**
+    For software rendered cores, this function is called by the core to acquire a framebuffer owned by the frontend.
+    The frontend fills the image with a buffer it allocated itself, for example persistently mapped texture upload memory,
+    so that the core can rasterize directly into it and presenting becomes a pointer handoff instead of a copy.
+    The core sets `width`, `height`, `channels` and `format` on input to say what it is about to render;
+    the frontend writes `data` and `stride`. The returned `stride` is the buffer's own row pitch — an
+    upload heap imposes the GPU's pitch alignment, so it may be larger than width * channels and the
+    core must rasterize with it rather than assume a packed layout.
+    The buffer remains valid and exclusively owned by the core until it is handed back with hcSwPresentFrameBuffer.
+    @param image Describes the frame on input; `data` and `stride` are returned by the frontend.
+    @return ::HC_SUCCESS
+    @return ::HC_ERROR_NOT_SOFTWARE_RENDERED
+*/
+typedef HcResult (HYDRA_API_CALL *HcSwAcquireFrameBufferPtr)(HcInstance instance, HcImageData* image);
+extern HcSwAcquireFrameBufferPtr hcSwAcquireFrameBuffer;
+
+/**
+    For software rendered cores, this function is called by the core to present a framebuffer previously
+    acquired with hcSwAcquireFrameBuffer. After this call the buffer belongs to the frontend again and the core
+    must not touch it until it is returned by a future hcSwAcquireFrameBuffer call.
+    Cores that can't render into an external buffer can keep using hcSwPushVideoFrame instead.
+    @param image The framebuffer to present. Must be the image filled by the matching hcSwAcquireFrameBuffer call.
+    @return ::HC_SUCCESS
+    @return ::HC_ERROR_NOT_SOFTWARE_RENDERED
+*/
+typedef HcResult (HYDRA_API_CALL *HcSwPresentFrameBufferPtr)(HcInstance instance, const HcImageData* image);
+extern HcSwPresentFrameBufferPtr hcSwPresentFrameBuffer;
+
 /**
     For OpenGL rendered cores, this function is called by the core to make the current thread owner of the OpenGL context.
     Should be called before the core starts rendering.
     @return ::HC_SUCCESS
     @return ::HC_ERROR_NOT_OPENGL_RENDERED
 */
-typedef HcResult (HYDRA_API_CALL *HcGlMakeCurrentPtr)();
+typedef HcResult (HYDRA_API_CALL *HcGlMakeCurrentPtr)(HcInstance instance);
 extern HcGlMakeCurrentPtr hcGlMakeCurrent;
 
 /**
@@ -486,27 +1143,236 @@ extern HcGlMakeCurrentPtr hcGlMakeCurrent;
     @return ::HC_SUCCESS
     @return ::HC_ERROR_NOT_OPENGL_RENDERED
 */
-typedef HcResult (HYDRA_API_CALL *HcGlSwapBuffersPtr)();
+typedef HcResult (HYDRA_API_CALL *HcGlSwapBuffersPtr)(HcInstance instance);
 extern HcGlSwapBuffersPtr hcGlSwapBuffers;
 
+/// An opaque handle to an additional OpenGL context created by the frontend and shared with the
+/// instance's main context. Defined by the frontend.
+typedef struct HcGlSharedContext_T* HcGlSharedContext;
+
+/**
+    For OpenGL rendered cores, this function asks the frontend for an additional context sharing
+    objects with the instance's main context, so the core can stream textures and compile shaders on
+    background threads instead of hitching the render thread. The frontend owns context creation,
+    which keeps this portable across EGL/GLX/WGL; platforms that can't share contexts (eg. the web
+    build) refuse with ::HC_ERROR_UNSUPPORTED and the core falls back to render-thread uploads.
+    @param context Will be set to the new shared context.
+    @return ::HC_SUCCESS
+    @return ::HC_ERROR_NOT_OPENGL_RENDERED
+    @return ::HC_ERROR_UNSUPPORTED
+*/
+typedef HcResult (HYDRA_API_CALL *HcGlCreateSharedContextPtr)(HcInstance instance, HcGlSharedContext* context);
+extern HcGlCreateSharedContextPtr hcGlCreateSharedContext;
+
+/**
+    For OpenGL rendered cores, this function makes a shared context created by
+    hcGlCreateSharedContext current on the calling thread. Each shared context may only be current
+    on one thread at a time.
+    @param context The shared context to make current.
+    @return ::HC_SUCCESS
+    @return ::HC_ERROR_NOT_OPENGL_RENDERED
+*/
+typedef HcResult (HYDRA_API_CALL *HcGlMakeCurrentSharedPtr)(HcInstance instance, HcGlSharedContext context);
+extern HcGlMakeCurrentSharedPtr hcGlMakeCurrentShared;
+
+/**
+    For OpenGL rendered cores, this function destroys a shared context created by
+    hcGlCreateSharedContext. The context must not be current on any thread.
+    @param context The shared context to destroy.
+    @return ::HC_SUCCESS
+    @return ::HC_ERROR_NOT_OPENGL_RENDERED
+*/
+typedef HcResult (HYDRA_API_CALL *HcGlDestroySharedContextPtr)(HcInstance instance, HcGlSharedContext context);
+extern HcGlDestroySharedContextPtr hcGlDestroySharedContext;
+
 /**
     For OpenGL rendered cores, this function is called by the core to get a function pointer to an OpenGL function.
     You can use it with GLAD or similar functions to load the OpenGL functions, as you normally would.
     @param name The name of the OpenGL function to get a pointer to.
     @return A pointer to the OpenGL function, or nullptr if the function is not found.
 */
-typedef void* (HYDRA_API_CALL *HcGlGetProcAddressPtr)(const char* name);
+typedef void* (HYDRA_API_CALL *HcGlGetProcAddressPtr)(HcInstance instance, const char* name);
 extern HcGlGetProcAddressPtr hcGlGetProcAddress;
 
+/**
+    For Vulkan rendered cores, this function is called by the core to hand the frontend a rendered frame.
+    The image lives on the device shared through HcVulkanContextInfo and is synchronized with the frame's
+    timeline semaphore, so presentation is a queue handoff with no copy and no device-wide flush.
+    @param image The exported frame.
+    @return ::HC_SUCCESS
+    @return ::HC_ERROR_NOT_VULKAN_RENDERED
+*/
+typedef HcResult (HYDRA_API_CALL *HcVkPushVideoFramePtr)(HcInstance instance, const HcVulkanFrameInfo* image);
+extern HcVkPushVideoFramePtr hcVkPushVideoFrame;
+
+/**
+    Create a lock from the frontend's lock pool. See HcLockRequest for what these are for.
+    @param request What kind of lock to create.
+    @param lock Will be set to the new lock.
+    @return ::HC_SUCCESS
+    @return ::HC_ERROR_NULL_DATA_PASSED
+    @return ::HC_ERROR_UNSUPPORTED The frontend doesn't vend locks (::HC_CAPABILITY_LOCKS unset).
+*/
+typedef HcResult (HYDRA_API_CALL *HcCreateLockPtr)(HcInstance instance, const HcLockRequest* request, HcLock* lock);
+extern HcCreateLockPtr hcCreateLock;
+
+/**
+    Acquire a lock created by hcCreateLock, blocking until it is available. Waiters sleep on a
+    futex-class primitive; they never spin.
+    @param lock The lock to acquire.
+    @return ::HC_SUCCESS
+    @return ::HC_ERROR_BAD_LOCK
+*/
+typedef HcResult (HYDRA_API_CALL *HcLockPtr)(HcInstance instance, HcLock lock);
+extern HcLockPtr hcLock;
+
+/**
+    Release a lock acquired with hcLock, waking one waiter if any.
+    @param lock The lock to release. Must be held by the calling thread.
+    @return ::HC_SUCCESS
+    @return ::HC_ERROR_BAD_LOCK
+*/
+typedef HcResult (HYDRA_API_CALL *HcUnlockPtr)(HcInstance instance, HcLock lock);
+extern HcUnlockPtr hcUnlock;
+
+/**
+    Destroy a lock created by hcCreateLock. The lock must not be held.
+    @param lock The lock to destroy.
+    @return ::HC_SUCCESS
+    @return ::HC_ERROR_BAD_LOCK
+*/
+typedef HcResult (HYDRA_API_CALL *HcDestroyLockPtr)(HcInstance instance, HcLock lock);
+extern HcDestroyLockPtr hcDestroyLock;
+
+/**
+    Map a named persistent storage region — battery saves, caches — into the core's address space.
+    The frontend owns where the bytes live (a file per region, keyed by core and content) and writes
+    dirty pages back asynchronously on its own I/O thread, so the core's save writes are plain
+    stores to mapped memory and never a blocking file operation on the emulation thread. A region is
+    created zero-filled on first map and keeps its contents across sessions. The mapping stays valid
+    until hcStorageUnmap or instance destruction.
+    @param name The name of the region, stable across sessions, eg. "sram".
+    @param size The size of the region in bytes. Must match the existing region's size when it already exists.
+    @param data Will be set to the mapped region.
+    @return ::HC_SUCCESS
+    @return ::HC_ERROR_BAD_STORAGE
+*/
+typedef HcResult (HYDRA_API_CALL *HcStorageMapPtr)(HcInstance instance, const char* name, size_t size, void** data);
+extern HcStorageMapPtr hcStorageMap;
+
+/**
+    Unmap a storage region mapped with hcStorageMap. Outstanding dirty pages are still written back
+    by the frontend; the core just may not touch the mapping anymore.
+    @param name The name of the region to unmap.
+    @return ::HC_SUCCESS
+    @return ::HC_ERROR_BAD_STORAGE
+*/
+typedef HcResult (HYDRA_API_CALL *HcStorageUnmapPtr)(HcInstance instance, const char* name);
+extern HcStorageUnmapPtr hcStorageUnmap;
+
+/**
+    Ask the frontend to schedule writeback of a mapped storage region now instead of at its own
+    pace, for moments where durability matters (the player just saved). Non-blocking: the write
+    still happens on the frontend's I/O thread.
+    @param name The name of the region to flush.
+    @return ::HC_SUCCESS
+    @return ::HC_ERROR_BAD_STORAGE
+*/
+typedef HcResult (HYDRA_API_CALL *HcStorageFlushPtr)(HcInstance instance, const char* name);
+extern HcStorageFlushPtr hcStorageFlush;
+
+/**
+    For self-driven cores, this function blocks until the display's next composition deadline and
+    returns the actual wakeup timestamp and refresh period. Cores pace their main loop with it
+    instead of nanosleep or spin loops, so they sync to vsync/VRR through the frontend's
+    presentation clock without burning CPU and without beating against the display's refresh.
+    @param timing Will be filled with the wakeup timestamp and the display's refresh period.
+    @return ::HC_SUCCESS
+    @return ::HC_ERROR_WRONG_DRIVE_MODE The core is frontend-driven; its pacing comes from runFrame.
+*/
+typedef HcResult (HYDRA_API_CALL *HcWaitForDisplayPtr)(HcInstance instance, HcDisplayTimingInfo* timing);
+extern HcWaitForDisplayPtr hcWaitForDisplay;
+
+/**
+    For Metal rendered cores, this function is called by the core to hand the frontend a rendered
+    frame, mirroring hcVkPushVideoFrame: a texture on the shared device, synchronized with a shared
+    event, so presentation never leaves the GPU.
+    @param image The exported frame.
+    @return ::HC_SUCCESS
+    @return ::HC_ERROR_NOT_METAL_RENDERED
+*/
+typedef HcResult (HYDRA_API_CALL *HcMtlPushVideoFramePtr)(HcInstance instance, const HcMetalFrameInfo* image);
+extern HcMtlPushVideoFramePtr hcMtlPushVideoFrame;
+
+/**
+    For Direct3D rendered cores, this function is called by the core to hand the frontend a rendered
+    frame, mirroring hcVkPushVideoFrame: a shared-handle texture on the common device,
+    fence-synchronized, so presentation never leaves the GPU.
+    @param image The exported frame.
+    @return ::HC_SUCCESS
+    @return ::HC_ERROR_NOT_DIRECT3D_RENDERED
+*/
+typedef HcResult (HYDRA_API_CALL *HcD3dPushVideoFramePtr)(HcInstance instance, const HcDirect3DFrameInfo* image);
+extern HcD3dPushVideoFramePtr hcD3dPushVideoFrame;
+
 /**
     For frontend-driven cores, this function sets the callbacks that the frontend will call to drive the core's main loop.
     @param callbacks The callbacks to set.
     @return ::HC_SUCCESS
     @return ::HC_ERROR_NOT_ALL_CALLBACKS_SET
 */
-typedef HcResult (HYDRA_API_CALL *HcSetCallbacksPtr)(const HcCallbacks* callbacks);
+typedef HcResult (HYDRA_API_CALL *HcSetCallbacksPtr)(HcInstance instance, const HcCallbacks* callbacks);
 extern HcSetCallbacksPtr hcSetCallbacks;
 
+/// All functions the frontend provides to the core, exchanged in a single call through hcInternalLoadFunctionTable
+/// instead of one string lookup per symbol. The table is versioned by `size` and `version` for forward compatibility:
+/// new functions are only ever appended, so a newer frontend can pass a larger table to an older core,
+/// which copies only the prefix it knows about.
+typedef struct HcFrontendFunctionTable {
+    uint32_t size; ///< sizeof(HcFrontendFunctionTable) as compiled by the frontend.
+    uint32_t version; ///< ::HYDRA_CORE_VERSION as compiled by the frontend.
+    HcGetHostInfoPtr getHostInfo;
+    HcGetInputsSyncPtr getInputsSync;
+    HcReconfigureEnvironmentPtr reconfigureEnvironment;
+    HcPushSamplesPtr pushSamples;
+    HcAudioOpenStreamPtr audioOpenStream;
+    HcAudioCloseStreamPtr audioCloseStream;
+    HcSwPushVideoFramePtr swPushVideoFrame;
+    HcSwAcquireFrameBufferPtr swAcquireFrameBuffer;
+    HcSwPresentFrameBufferPtr swPresentFrameBuffer;
+    HcGlMakeCurrentPtr glMakeCurrent;
+    HcGlSwapBuffersPtr glSwapBuffers;
+    HcGlGetProcAddressPtr glGetProcAddress;
+    HcSetCallbacksPtr setCallbacks;
+    HcVkPushVideoFramePtr vkPushVideoFrame;
+    HcWaitForDisplayPtr waitForDisplay;
+    HcGlCreateSharedContextPtr glCreateSharedContext;
+    HcGlMakeCurrentSharedPtr glMakeCurrentShared;
+    HcGlDestroySharedContextPtr glDestroySharedContext;
+    HcGetAudioQueueStatusPtr getAudioQueueStatus;
+    HcCreateLockPtr createLock;
+    HcLockPtr lock;
+    HcUnlockPtr unlock;
+    HcDestroyLockPtr destroyLock;
+    HcMtlPushVideoFramePtr mtlPushVideoFrame;
+    HcD3dPushVideoFramePtr d3dPushVideoFrame;
+    HcGetInputsBatchedPtr getInputsBatched;
+    HcStorageMapPtr storageMap;
+    HcStorageUnmapPtr storageUnmap;
+    HcStorageFlushPtr storageFlush;
+} HcFrontendFunctionTable;
+
+/**
+    The frontend calls this function once after loading the core to hand over every imported function in one go,
+    the same way a Vulkan loader hands a device dispatch table to a layer. This replaces resolving each symbol
+    with a separate string lookup, which cost one frontend round trip per function at every core load.
+    @param table The frontend's function table. All functions in the table must be set.
+    @return ::HC_SUCCESS
+    @return ::HC_INTERNAL_ERROR_BAD_FUNCTION_TABLE
+    @return ::HC_INTERNAL_ERROR_MISSING_FUNCTION
+*/
+HYDRA_API_EXPORT HYDRA_API_ATTR HcResult HYDRA_API_CALL hcInternalLoadFunctionTable(const HcFrontendFunctionTable* table);
+
 /**
     Get information about the core. Will be called one time, once the core is loaded.
     @param coreInfo The HcCoreInfo struct to fill with information about the core.
@@ -514,50 +1380,164 @@ extern HcSetCallbacksPtr hcSetCallbacks;
 HYDRA_API_EXPORT HYDRA_API_ATTR void HYDRA_API_CALL hcGetCoreInfo(HcCoreInfo* coreInfo);
 
 /**
-    Initialize the core.
-    Each core is tied to a window and a particular renderer API, configured from environmentInfo.
-    @param[out] environmentInfo Information about the environment the core is running in. This needs to be populated by the core.
+    Get the core's icon, decoded at most maxDimension pixels wide and high. The frontend calls this
+    only when (and at the size) it actually draws the icon — a thumbnail grid over 40 cores asks for
+    thumbnails, not full-size decodes at load time. Like hcGetCoreInfo it is per-image: no instance
+    is needed, and hcGetCoreInfo itself should stay allocation-free.
+    The pixel data is owned by the core and stays valid until the next hcGetCoreIcon call on this
+    image or until the core is unloaded.
+    @param[in] maxDimension The maximum width and height of the returned icon, in pixels.
+    @param[out] icon Will be filled with the icon image.
+    @return ::HC_SUCCESS
+    @return ::HC_ERROR_NULL_DATA_PASSED
+    @return ::HC_ERROR_UNSUPPORTED The core has no icon.
+*/
+HYDRA_API_EXPORT HYDRA_API_ATTR HcResult HYDRA_API_CALL hcGetCoreIcon(uint32_t maxDimension, HcImageData* icon);
+
+/**
+    Decide from the first bytes of a file whether this core can run it, without loading it.
+    Extension matching alone misidentifies files, and a full hcLoadContent per candidate is far too
+    slow for scanning a library of tens of thousands of files — this call must do no I/O and no
+    allocation, so a scan reads a few kilobytes per file sequentially. Like hcGetCoreInfo it is
+    per-image: no instance is needed.
+    @param[in] info The file name and its first bytes.
+    @param[out] confidence Will be set to how confident the core is that the content is for it.
+    @return ::HC_SUCCESS
+    @return ::HC_ERROR_NULL_DATA_PASSED
+*/
+HYDRA_API_EXPORT HYDRA_API_ATTR HcResult HYDRA_API_CALL hcProbeContent(const HcContentProbeInfo* info, HcProbeConfidence* confidence);
+
+/**
+    Create a new instance of the core.
+    Each instance is tied to a window and a particular renderer API, configured from environmentInfo.
+    One core image can serve multiple instances at once; state must not be shared between them
+    except for read-only data such as code and loaded content.
+    @param[out] environmentInfo Information about the environment the instance is running in. This needs to be populated by the core.
+    @param[out] instance Will be set to the handle of the created instance. Left untouched on
+    failure; the error message is then available through hcGetError(NULL).
     @return ::HC_SUCCESS
     @return ::HC_ERROR_CORE
 */
-HYDRA_API_EXPORT HYDRA_API_ATTR HcResult HYDRA_API_CALL hcCreate(HcEnvironmentInfo* const environmentInfo);
+HYDRA_API_EXPORT HYDRA_API_ATTR HcResult HYDRA_API_CALL hcCreate(HcEnvironmentInfo* const environmentInfo, HcInstance* instance);
 
 /**
-    Destroy the core, freeing any resources it has allocated.
-    @param[in] destroyInfo Information about the destruction of the core. Currently unused.
+    Destroy an instance of the core, freeing any resources it has allocated.
+    @param[in] instance The instance to destroy.
+    @param[in] destroyInfo Information about the destruction of the instance. Currently unused.
     @return ::HC_SUCCESS
+    @return ::HC_ERROR_BAD_INSTANCE
     @return ::HC_ERROR_CORE
 */
-HYDRA_API_EXPORT HYDRA_API_ATTR HcResult HYDRA_API_CALL hcDestroy(const HcDestroyInfo* destroyInfo);
+HYDRA_API_EXPORT HYDRA_API_ATTR HcResult HYDRA_API_CALL hcDestroy(HcInstance instance, const HcDestroyInfo* destroyInfo);
 
 /**
-    Reset the core.
-    @param[in] resetInfo Information about the reset of the core.
+    Reset the core instance.
+    @param[in] instance The instance to reset.
+    @param[in] resetInfo Information about the reset of the instance.
     @return ::HC_SUCCESS
+    @return ::HC_ERROR_BAD_INSTANCE
     @return ::HC_ERROR_CORE
 */
-HYDRA_API_EXPORT HYDRA_API_ATTR HcResult HYDRA_API_CALL hcReset(const HcResetInfo* resetInfo);
+HYDRA_API_EXPORT HYDRA_API_ATTR HcResult HYDRA_API_CALL hcReset(HcInstance instance, const HcResetInfo* resetInfo);
 
 /**
-    Set the run state of the core, as in running, paused, or quit.
-    @param[in] runInfo Information about the desired run state of the core.
+    Set the run state of the core instance, as in running, paused, or quit.
+    When an HcSharedRunState is chained in the environment, the frontend updates the block before
+    making this call, and the call's job is only to wake the core if it is blocked somewhere.
+    @param[in] instance The instance whose run state to set.
+    @param[in] runInfo Information about the desired run state of the instance.
 */
-HYDRA_API_EXPORT HYDRA_API_ATTR HcResult HYDRA_API_CALL hcSetRunState(const HcRunStateInfo* runInfo);
+HYDRA_API_EXPORT HYDRA_API_ATTR HcResult HYDRA_API_CALL hcSetRunState(HcInstance instance, const HcRunStateInfo* runInfo);
 
 /**
-    Load content into the core.
+    Load content into the core instance.
+    When the frontend chains an HcContentMemoryInfo or HcContentStreamInfo on info->next, the core
+    should prefer it over opening info->path itself, so large content can be demand-paged or streamed.
+    @param[in] instance The instance to load the content into.
     @param[in] info Information about the content to load.
     @return ::HC_SUCCESS
+    @return ::HC_ERROR_BAD_INSTANCE
     @return ::HC_ERROR_BAD_CONTENT
     @return ::HC_ERROR_CORE
 */
-HYDRA_API_EXPORT HYDRA_API_ATTR HcResult HYDRA_API_CALL hcLoadContent(const HcContentLoadInfo* info);
+HYDRA_API_EXPORT HYDRA_API_ATTR HcResult HYDRA_API_CALL hcLoadContent(HcInstance instance, const HcContentLoadInfo* info);
+
+/**
+    Get the table of memory regions of the emulated system, so the frontend reads guest memory in
+    place instead of asking the core for copies. The table is owned by the core and stays valid for
+    the lifetime of the loaded content; the base pointers go stale when content is unloaded or the
+    instance is destroyed.
+    @param[in] instance The instance whose memory regions to get.
+    @param[out] regions Will be set to the core's region table.
+    @param[out] regionCount Will be set to the number of regions in the table.
+    @return ::HC_SUCCESS
+    @return ::HC_ERROR_BAD_INSTANCE
+    @return ::HC_ERROR_BAD_CONTENT No content is loaded, so there are no regions yet.
+*/
+HYDRA_API_EXPORT HYDRA_API_ATTR HcResult HYDRA_API_CALL hcGetMemoryRegions(HcInstance instance, const HcMemoryRegion** regions, uint32_t* regionCount);
+
+/**
+    Get the size in bytes a state of the given type needs, so the caller can allocate its arena up front.
+    The size stays constant while the same content is loaded, so frontends doing run-ahead allocate once.
+    @param[in] instance The instance to query.
+    @param[in] stateType The type of state the size is asked for.
+    @param[out] size Will be set to the required arena size in bytes.
+    @return ::HC_SUCCESS
+    @return ::HC_ERROR_BAD_INSTANCE
+    @return ::HC_ERROR_CORE
+*/
+HYDRA_API_EXPORT HYDRA_API_ATTR HcResult HYDRA_API_CALL hcGetStateSize(HcInstance instance, HcStateType stateType, size_t* size);
+
+/**
+    Save the instance state into the caller-provided arena in info, without allocating.
+    ::HC_STATE_TYPE_VOLATILE saves are the hot path for run-ahead and rollback and should be
+    sub-millisecond; chain an HcStateDirtyRangesInfo to let the core skip unchanged memory when
+    saving into the same arena every frame.
+    @param[in] instance The instance whose state to save.
+    @param[in,out] info Where and how to save the state. The core updates info->size to the bytes written.
+    @return ::HC_SUCCESS
+    @return ::HC_ERROR_BAD_INSTANCE
+    @return ::HC_ERROR_STATE_BUFFER_TOO_SMALL
+    @return ::HC_ERROR_CORE
+*/
+HYDRA_API_EXPORT HYDRA_API_ATTR HcResult HYDRA_API_CALL hcSaveState(HcInstance instance, HcStateInfo* info);
+
+/**
+    Restore the instance state from a state previously saved with hcSaveState.
+    ::HC_STATE_TYPE_VOLATILE states can only be loaded by the instance configuration that saved them,
+    with the same content loaded.
+    @param[in] instance The instance whose state to restore.
+    @param[in] info The state to restore.
+    @return ::HC_SUCCESS
+    @return ::HC_ERROR_BAD_INSTANCE
+    @return ::HC_ERROR_BAD_STATE
+    @return ::HC_ERROR_CORE
+*/
+HYDRA_API_EXPORT HYDRA_API_ATTR HcResult HYDRA_API_CALL hcLoadState(HcInstance instance, const HcStateInfo* info);
+
+/**
+    Load content into the core instance without blocking the caller. The core starts the load in the
+    background and reports through the callbacks: progress while reading, playable as soon as it can
+    begin emitting frames (typically combined with an HcContentStreamInfo so the rest of the image
+    keeps loading behind execution), and complete when done. Time to first frame is what this exists
+    for: a core that can start from the first megabytes should signal playable as early as it can.
+    @param[in] instance The instance to load the content into.
+    @param[in] info Information about the content to load.
+    @param[in] callbacks The callbacks to report through. Must stay valid until complete is called.
+    @return ::HC_SUCCESS The load was started; the outcome arrives through complete.
+    @return ::HC_ERROR_BAD_INSTANCE
+    @return ::HC_ERROR_NULL_DATA_PASSED
+    @return ::HC_ERROR_UNSUPPORTED The core can't load asynchronously; use hcLoadContent.
+*/
+HYDRA_API_EXPORT HYDRA_API_ATTR HcResult HYDRA_API_CALL hcLoadContentAsync(HcInstance instance, const HcContentLoadInfo* info, const HcContentLoadCallbacks* callbacks);
 
 /**
-    Return the error message of the last ::HC_ERROR_CORE that occurred.
+    Return the error message of the last ::HC_ERROR_CORE that occurred on the given instance.
+    @param[in] instance The instance whose error message to return. May be NULL to retrieve the
+    message of an error that happened before any instance existed, ie. a failed hcCreate.
     @return A string containing the error message, or nullptr if no error occurred.
 */
-HYDRA_API_EXPORT HYDRA_API_ATTR const char* HYDRA_API_CALL hcGetError();
+HYDRA_API_EXPORT HYDRA_API_ATTR const char* HYDRA_API_CALL hcGetError(HcInstance instance);
 
 #ifdef __cplusplus
 }
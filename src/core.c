@@ -4,66 +4,92 @@ HcGetHostInfoPtr hcGetHostInfo = NULL;
 HcGetInputsSyncPtr hcGetInputsSync = NULL;
 HcReconfigureEnvironmentPtr hcReconfigureEnvironment = NULL;
 HcPushSamplesPtr hcPushSamples = NULL;
+HcAudioOpenStreamPtr hcAudioOpenStream = NULL;
+HcAudioCloseStreamPtr hcAudioCloseStream = NULL;
 HcSwPushVideoFramePtr hcSwPushVideoFrame = NULL;
+HcSwAcquireFrameBufferPtr hcSwAcquireFrameBuffer = NULL;
+HcSwPresentFrameBufferPtr hcSwPresentFrameBuffer = NULL;
 HcGlMakeCurrentPtr hcGlMakeCurrent = NULL;
 HcGlSwapBuffersPtr hcGlSwapBuffers = NULL;
 HcGlGetProcAddressPtr hcGlGetProcAddress = NULL;
 HcSetCallbacksPtr hcSetCallbacks = NULL;
+HcVkPushVideoFramePtr hcVkPushVideoFrame = NULL;
+HcWaitForDisplayPtr hcWaitForDisplay = NULL;
+HcGlCreateSharedContextPtr hcGlCreateSharedContext = NULL;
+HcGlMakeCurrentSharedPtr hcGlMakeCurrentShared = NULL;
+HcGlDestroySharedContextPtr hcGlDestroySharedContext = NULL;
+HcGetAudioQueueStatusPtr hcGetAudioQueueStatus = NULL;
+HcCreateLockPtr hcCreateLock = NULL;
+HcLockPtr hcLock = NULL;
+HcUnlockPtr hcUnlock = NULL;
+HcDestroyLockPtr hcDestroyLock = NULL;
+HcMtlPushVideoFramePtr hcMtlPushVideoFrame = NULL;
+HcD3dPushVideoFramePtr hcD3dPushVideoFrame = NULL;
+HcGetInputsBatchedPtr hcGetInputsBatched = NULL;
+HcStorageMapPtr hcStorageMap = NULL;
+HcStorageUnmapPtr hcStorageUnmap = NULL;
+HcStorageFlushPtr hcStorageFlush = NULL;
 
 /**
-    The frontend will call this function with a pointer that can load the function pointers.
-    This is pretty much what happens when you use a loader in OpenGL to load the function pointers,
-    for example gladLoadGLLoader where you pass something like SDL_GL_GetProcAddress or glfwGetProcAddress etc.
+    The frontend will call this function with its function table so the core can copy it wholesale,
+    instead of resolving every imported function with a separate string lookup the way OpenGL loaders do.
+    The table is validated once: the major version must match and every function the core knows about must be set.
+    A newer frontend may pass a larger table than the core was compiled against; the extra entries are ignored.
 */
-HYDRA_API_EXPORT HYDRA_API_ATTR HcResult HYDRA_API_CALL hcInternalLoadFunctions(void*(*loadFunctionPtr)(const char*)) {
-    if (!loadFunctionPtr) {
-        return HC_INTERNAL_ERROR_BAD_LOADFUNCTIONPTR;
+HYDRA_API_EXPORT HYDRA_API_ATTR HcResult HYDRA_API_CALL hcInternalLoadFunctionTable(const HcFrontendFunctionTable* table) {
+    if (!table) {
+        return HC_INTERNAL_ERROR_BAD_FUNCTION_TABLE;
     }
 
-    hcGetHostInfo = (HcGetHostInfoPtr)loadFunctionPtr("hcGetHostInfo");
-    if (!hcGetHostInfo) {
-        return HC_INTERNAL_ERROR_MISSING_FUNCTION;
-    }
-
-    hcGetInputsSync = (HcGetInputsSyncPtr)loadFunctionPtr("hcGetInputsSync");
-    if (!hcGetInputsSync) {
-        return HC_INTERNAL_ERROR_MISSING_FUNCTION;
-    }
-
-    hcReconfigureEnvironment = (HcReconfigureEnvironmentPtr)loadFunctionPtr("hcReconfigureEnvironment");
-    if (!hcReconfigureEnvironment) {
-        return HC_INTERNAL_ERROR_MISSING_FUNCTION;
-    }
-
-    hcPushSamples = (HcPushSamplesPtr)loadFunctionPtr("hcPushSamples");
-    if (!hcPushSamples) {
-        return HC_INTERNAL_ERROR_MISSING_FUNCTION;
+    if ((table->version >> 16) != HYDRA_CORE_MAJOR) {
+        return HC_INTERNAL_ERROR_BAD_FUNCTION_TABLE;
     }
 
-    hcSwPushVideoFrame = (HcSwPushVideoFramePtr)loadFunctionPtr("hcSwPushVideoFrame");
-    if (!hcSwPushVideoFrame) {
+    if (table->size < sizeof(HcFrontendFunctionTable)) {
         return HC_INTERNAL_ERROR_MISSING_FUNCTION;
     }
 
-    hcGlMakeCurrent = (HcGlMakeCurrentPtr)loadFunctionPtr("hcGlMakeCurrent");
-    if (!hcGlMakeCurrent) {
+    if (!table->getHostInfo || !table->getInputsSync || !table->reconfigureEnvironment ||
+        !table->pushSamples || !table->audioOpenStream || !table->audioCloseStream ||
+        !table->swPushVideoFrame || !table->swAcquireFrameBuffer || !table->swPresentFrameBuffer ||
+        !table->glMakeCurrent || !table->glSwapBuffers || !table->glGetProcAddress ||
+        !table->setCallbacks || !table->vkPushVideoFrame || !table->waitForDisplay ||
+        !table->glCreateSharedContext || !table->glMakeCurrentShared || !table->glDestroySharedContext ||
+        !table->getAudioQueueStatus || !table->createLock || !table->lock || !table->unlock ||
+        !table->destroyLock || !table->mtlPushVideoFrame || !table->d3dPushVideoFrame ||
+        !table->getInputsBatched || !table->storageMap || !table->storageUnmap || !table->storageFlush) {
         return HC_INTERNAL_ERROR_MISSING_FUNCTION;
     }
 
-    hcGlSwapBuffers = (HcGlSwapBuffersPtr)loadFunctionPtr("hcGlSwapBuffers");
-    if (!hcGlSwapBuffers) {
-        return HC_INTERNAL_ERROR_MISSING_FUNCTION;
-    }
-
-    hcGlGetProcAddress = (HcGlGetProcAddressPtr)loadFunctionPtr("hcGlGetProcAddress");
-    if (!hcGlGetProcAddress) {
-        return HC_INTERNAL_ERROR_MISSING_FUNCTION;
-    }
-
-    hcSetCallbacks = (HcSetCallbacksPtr)loadFunctionPtr("hcSetCallbacks");
-    if (!hcSetCallbacks) {
-        return HC_INTERNAL_ERROR_MISSING_FUNCTION;
-    }
+    hcGetHostInfo = table->getHostInfo;
+    hcGetInputsSync = table->getInputsSync;
+    hcReconfigureEnvironment = table->reconfigureEnvironment;
+    hcPushSamples = table->pushSamples;
+    hcAudioOpenStream = table->audioOpenStream;
+    hcAudioCloseStream = table->audioCloseStream;
+    hcSwPushVideoFrame = table->swPushVideoFrame;
+    hcSwAcquireFrameBuffer = table->swAcquireFrameBuffer;
+    hcSwPresentFrameBuffer = table->swPresentFrameBuffer;
+    hcGlMakeCurrent = table->glMakeCurrent;
+    hcGlSwapBuffers = table->glSwapBuffers;
+    hcGlGetProcAddress = table->glGetProcAddress;
+    hcSetCallbacks = table->setCallbacks;
+    hcVkPushVideoFrame = table->vkPushVideoFrame;
+    hcWaitForDisplay = table->waitForDisplay;
+    hcGlCreateSharedContext = table->glCreateSharedContext;
+    hcGlMakeCurrentShared = table->glMakeCurrentShared;
+    hcGlDestroySharedContext = table->glDestroySharedContext;
+    hcGetAudioQueueStatus = table->getAudioQueueStatus;
+    hcCreateLock = table->createLock;
+    hcLock = table->lock;
+    hcUnlock = table->unlock;
+    hcDestroyLock = table->destroyLock;
+    hcMtlPushVideoFrame = table->mtlPushVideoFrame;
+    hcD3dPushVideoFrame = table->d3dPushVideoFrame;
+    hcGetInputsBatched = table->getInputsBatched;
+    hcStorageMap = table->storageMap;
+    hcStorageUnmap = table->storageUnmap;
+    hcStorageFlush = table->storageFlush;
 
     return HC_SUCCESS;
-}
\ No newline at end of file
+}